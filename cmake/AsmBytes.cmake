@@ -0,0 +1,37 @@
+# AsmBytes.cmake - helpers for the scripts that write ca65 .byte tables
+
+# value as $XX
+function(hex value out)
+    math(EXPR h "${value}" OUTPUT_FORMAT HEXADECIMAL)
+    string(SUBSTRING "${h}" 2 -1 h)
+    string(TOUPPER "${h}" h)
+    string(LENGTH "${h}" len)
+    if(len LESS 2)
+        set(h "0${h}")
+    endif()
+    set(${out} "$${h}" PARENT_SCOPE)
+endfunction()
+
+# The list named by values as .byte lines, 12 to a line
+function(byte_lines values out)
+    set(text "")
+    set(line "")
+    set(n 0)
+    foreach(v ${${values}})
+        hex(${v} h)
+        if(n EQUAL 0)
+            set(line "    .byte   ${h}")
+        else()
+            set(line "${line}, ${h}")
+        endif()
+        math(EXPR n "${n} + 1")
+        if(n EQUAL 12)
+            string(APPEND text "${line}\n")
+            set(n 0)
+        endif()
+    endforeach()
+    if(n GREATER 0)
+        string(APPEND text "${line}\n")
+    endif()
+    set(${out} "${text}" PARENT_SCOPE)
+endfunction()
@@ -0,0 +1,108 @@
+# GenCharmaps.cmake - make a target's 256 byte text translation tables
+#
+# cmake -DPLATFORM=c64|atarixl -DOUTPUT=charmaps.s -P GenCharmaps.cmake
+#
+# Each table turns a byte into another with a single indexed load, so the
+# per character compare chains in the text paths go away:
+#   c64     - charmap_ascii_to_log      server ASCII to what the logs hold
+#             charmap_log_to_screen     log text to font screen codes
+#             charmap_log_to_petscii    log text to cputc PETSCII
+#             charmap_petscii_to_ascii  typed PETSCII to server ASCII, 0 drops
+#   atarixl - charmap_ascii_to_internal ASCII to ANTIC internal codes
+#             charmap_atascii_to_ascii  typed ATASCII to server ASCII
+# The apple2 text is ASCII all the way through, so it needs no tables
+
+if(NOT PLATFORM OR NOT OUTPUT)
+    message(FATAL_ERROR "GenCharmaps.cmake: PLATFORM and OUTPUT are required.")
+endif()
+
+include(${CMAKE_CURRENT_LIST_DIR}/AsmBytes.cmake)
+
+# --- The rules, one byte at a time ---
+function(ascii_to_log c out)
+    if(c GREATER_EQUAL 65 AND c LESS_EQUAL 90)      # 'A-Z' to PETSCII
+        math(EXPR c "${c} | 0x80")
+    endif()
+    set(${out} ${c} PARENT_SCOPE)
+endfunction()
+
+function(log_to_screen c out)
+    if(c GREATER_EQUAL 193 AND c LESS_EQUAL 218)    # PETSCII 'A-Z'
+        math(EXPR c "${c} & 0x7F")
+    elseif(c GREATER_EQUAL 65 AND c LESS_EQUAL 90)  # Lowercase to 1-26
+        math(EXPR c "${c} - 64")
+    elseif(c GREATER_EQUAL 97 AND c LESS_EQUAL 123) # Lowercase ascii to 1-26
+        math(EXPR c "${c} - 96")
+    endif()
+    set(${out} ${c} PARENT_SCOPE)
+endfunction()
+
+function(log_to_petscii c out)
+    if(c GREATER_EQUAL 65 AND c LESS_EQUAL 90)
+        math(EXPR c "${c} | 32")
+    elseif(c GREATER_EQUAL 97 AND c LESS_EQUAL 122)
+        math(EXPR c "${c} & ~32")
+    endif()
+    set(${out} ${c} PARENT_SCOPE)
+endfunction()
+
+function(petscii_to_ascii c out)
+    if(c EQUAL 13)                                  # \r to \n
+        set(c 10)
+    elseif(c LESS 32 OR c GREATER_EQUAL 219)        # Ignore too small and big
+        set(c 0)
+    elseif(c GREATER_EQUAL 193)                     # PETSCII 'A-Z' to ASCII 'A-Z'
+        math(EXPR c "${c} & ~128")
+    elseif(c GREATER_EQUAL 123)                     # Ignore 123 - 192
+        set(c 0)
+    elseif(c GREATER_EQUAL 65 AND c LESS_EQUAL 90)  # PETSCII 'a-z' to ASCII 'a-z'
+        math(EXPR c "${c} | 32")
+    endif()
+    set(${out} ${c} PARENT_SCOPE)
+endfunction()
+
+function(ascii_to_internal c out)
+    math(EXPR inverse "${c} & 0x80")
+    math(EXPR c "${c} & 0x7F")
+    if(c LESS 32)
+        math(EXPR c "${c} + 64")
+    elseif(c LESS 96)
+        math(EXPR c "${c} - 32")
+    endif()
+    math(EXPR c "${c} | ${inverse}")
+    set(${out} ${c} PARENT_SCOPE)
+endfunction()
+
+function(atascii_to_ascii c out)
+    if(c EQUAL 155)                                 # EOL to \n
+        set(c 10)
+    endif()
+    set(${out} ${c} PARENT_SCOPE)
+endfunction()
+
+if(PLATFORM STREQUAL "c64")
+    set(tables ascii_to_log log_to_screen log_to_petscii petscii_to_ascii)
+elseif(PLATFORM STREQUAL "atarixl")
+    set(tables ascii_to_internal atascii_to_ascii)
+else()
+    message(FATAL_ERROR "GenCharmaps.cmake: no tables for platform '${PLATFORM}'.")
+endif()
+
+# --- Write the asm ---
+get_filename_component(output_name ${OUTPUT} NAME)
+set(text ";\n; ${output_name}\n; RetroMate\n;\n; Made by cmake/GenCharmaps.cmake - don't edit\n;\n\n")
+foreach(table ${tables})
+    string(APPEND text ".export _charmap_${table}\n")
+endforeach()
+string(APPEND text "\n.rodata\n")
+foreach(table ${tables})
+    set(bytes "")
+    foreach(c RANGE 0 255)
+        cmake_language(CALL ${table} ${c} b)
+        list(APPEND bytes ${b})
+    endforeach()
+    byte_lines(bytes lines)
+    string(APPEND text "\n_charmap_${table}:\n${lines}")
+endforeach()
+
+file(WRITE ${OUTPUT} "${text}")
@@ -0,0 +1,208 @@
+# GenPieces.cmake - make a target's hires_pieces from assets/pieces.txt
+#
+# cmake -DPLATFORM=c64|apple2|atarixl -DART=pieces.txt -DOUTPUT=pieces.s -P GenPieces.cmake
+#
+# The art is 24 x 22 pixels a tile.  Each target places it in its own tile
+# size and packs the pixels the way its hires_draw reads them:
+#   atarixl - 24 x 22, 3 bytes a row, leftmost pixel in bit 7
+#   apple2  - 21 x 22, 3 bytes a row of 7 pixels, leftmost pixel in bit 0
+#   c64     - 24 x 24, one row lower and one pixel right, in 3 x 3 character
+#             cells of 8 bytes.  RLE packed into ONCE as pieces_rle, which
+#             hiresC64.s unpacks under the Kernal ROM before main
+
+if(NOT PLATFORM OR NOT ART OR NOT OUTPUT)
+    message(FATAL_ERROR "GenPieces.cmake: PLATFORM, ART and OUTPUT are required.")
+endif()
+
+set(art_width 24)
+set(art_height 22)
+set(num_tiles 12)
+
+if(PLATFORM STREQUAL "atarixl")
+    set(tile_width 24)
+    set(tile_height 22)
+    set(row_offset 0)
+    set(col_offset 0)
+elseif(PLATFORM STREQUAL "apple2")
+    set(tile_width 21)
+    set(tile_height 22)
+    set(row_offset 0)
+    set(col_offset -1)
+elseif(PLATFORM STREQUAL "c64")
+    set(tile_width 24)
+    set(tile_height 24)
+    set(row_offset 1)
+    set(col_offset 1)
+else()
+    message(FATAL_ERROR "GenPieces.cmake: no layout for platform '${PLATFORM}'.")
+endif()
+
+# --- Read the art ---
+file(STRINGS ${ART} art_lines REGEX "^\"")
+set(art_rows "")
+foreach(line ${art_lines})
+    string(REGEX REPLACE "^\"(.*)\"$" "\\1" row "${line}")
+    string(LENGTH "${row}" len)
+    if(NOT len EQUAL art_width)
+        message(FATAL_ERROR "GenPieces.cmake: '${row}' isn't ${art_width} pixels wide.")
+    endif()
+    list(APPEND art_rows "${row}")
+endforeach()
+list(LENGTH art_rows num_rows)
+math(EXPR expected "${num_tiles} * ${art_height}")
+if(NOT num_rows EQUAL expected)
+    message(FATAL_ERROR "GenPieces.cmake: ${num_rows} rows of art, expected ${expected}.")
+endif()
+
+# 1 if the pixel at x, y in the target's tile is set
+function(pixel tile x y out)
+    math(EXPR ay "${y} - ${row_offset}")
+    math(EXPR ax "${x} - ${col_offset}")
+    if(ay LESS 0 OR ay GREATER_EQUAL art_height OR ax LESS 0 OR ax GREATER_EQUAL art_width)
+        set(${out} 0 PARENT_SCOPE)
+        return()
+    endif()
+    math(EXPR index "${tile} * ${art_height} + ${ay}")
+    list(GET art_rows ${index} row)
+    string(SUBSTRING "${row}" ${ax} 1 c)
+    if(c STREQUAL "*")
+        set(${out} 1 PARENT_SCOPE)
+    else()
+        set(${out} 0 PARENT_SCOPE)
+    endif()
+endfunction()
+
+# 8 pixels from x in row y, leftmost in bit 7
+function(byte_msb tile x y out)
+    set(value 0)
+    foreach(bit RANGE 0 7)
+        math(EXPR px "${x} + ${bit}")
+        pixel(${tile} ${px} ${y} p)
+        math(EXPR value "${value} | (${p} << (7 - ${bit}))")
+    endforeach()
+    set(${out} ${value} PARENT_SCOPE)
+endfunction()
+
+# 7 pixels from x in row y, leftmost in bit 0 (the Apple II hires order)
+function(byte_lsb7 tile x y out)
+    set(value 0)
+    foreach(bit RANGE 0 6)
+        math(EXPR px "${x} + ${bit}")
+        pixel(${tile} ${px} ${y} p)
+        math(EXPR value "${value} | (${p} << ${bit})")
+    endforeach()
+    set(${out} ${value} PARENT_SCOPE)
+endfunction()
+
+# --- Make the bytes, a list per tile ---
+math(EXPR last_tile "${num_tiles} - 1")
+math(EXPR last_row "${tile_height} - 1")
+foreach(tile RANGE 0 ${last_tile})
+    set(bytes "")
+    if(PLATFORM STREQUAL "c64")
+        foreach(cell_row RANGE 0 2)
+            foreach(cell_col RANGE 0 2)
+                foreach(line RANGE 0 7)
+                    math(EXPR y "${cell_row} * 8 + ${line}")
+                    math(EXPR x "${cell_col} * 8")
+                    byte_msb(${tile} ${x} ${y} b)
+                    list(APPEND bytes ${b})
+                endforeach()
+            endforeach()
+        endforeach()
+    else()
+        foreach(y RANGE 0 ${last_row})
+            foreach(col RANGE 0 2)
+                if(PLATFORM STREQUAL "apple2")
+                    math(EXPR x "${col} * 7")
+                    byte_lsb7(${tile} ${x} ${y} b)
+                else()
+                    math(EXPR x "${col} * 8")
+                    byte_msb(${tile} ${x} ${y} b)
+                endif()
+                list(APPEND bytes ${b})
+            endforeach()
+        endforeach()
+    endif()
+    set(tile_${tile} ${bytes})
+endforeach()
+
+# --- RLE, for the c64 ---
+# $01..$7F n literal bytes follow, $81..$FF the next byte n & $7F times, $00 ends
+function(rle in out)
+    set(packed "")
+    set(literals "")
+    list(LENGTH ${in} count)
+    set(i 0)
+    while(i LESS count)
+        list(GET ${in} ${i} value)
+        set(run 1)
+        math(EXPR j "${i} + 1")
+        while(j LESS count AND run LESS 127)
+            list(GET ${in} ${j} next)
+            if(NOT next EQUAL value)
+                break()
+            endif()
+            math(EXPR run "${run} + 1")
+            math(EXPR j "${j} + 1")
+        endwhile()
+        list(LENGTH literals num_literals)
+        if(run GREATER 2 OR num_literals EQUAL 127)
+            if(num_literals GREATER 0)
+                list(APPEND packed ${num_literals} ${literals})
+                set(literals "")
+            endif()
+        endif()
+        if(run GREATER 2)
+            math(EXPR control "0x80 | ${run}")
+            list(APPEND packed ${control} ${value})
+            math(EXPR i "${i} + ${run}")
+        else()
+            list(APPEND literals ${value})
+            math(EXPR i "${i} + 1")
+        endif()
+    endwhile()
+    list(LENGTH literals num_literals)
+    if(num_literals GREATER 0)
+        list(APPEND packed ${num_literals} ${literals})
+    endif()
+    list(APPEND packed 0)
+    set(${out} ${packed} PARENT_SCOPE)
+endfunction()
+
+# --- Write the asm ---
+include(${CMAKE_CURRENT_LIST_DIR}/AsmBytes.cmake)
+
+set(piece_names Rook Knight Bishop Queen King Pawn)
+get_filename_component(output_name ${OUTPUT} NAME)
+set(text ";\n; ${output_name}\n; RetroMate\n;\n; Made from assets/pieces.txt by cmake/GenPieces.cmake - don't edit\n;\n\n")
+
+if(PLATFORM STREQUAL "c64")
+    set(all "")
+    foreach(tile RANGE 0 ${last_tile})
+        list(APPEND all ${tile_${tile}})
+    endforeach()
+    rle(all packed)
+    list(LENGTH all unpacked_size)
+    list(LENGTH packed packed_size)
+    string(APPEND text ".export pieces_rle\n\n")
+    string(APPEND text "; ${unpacked_size} bytes of tiles in ${packed_size}\n.segment \"ONCE\"\n\npieces_rle:\n")
+    byte_lines(packed lines)
+    string(APPEND text "${lines}")
+else()
+    string(APPEND text ".export _hires_pieces\n\n.rodata\n\n_hires_pieces:\n")
+    foreach(tile RANGE 0 ${last_tile})
+        math(EXPR piece "${tile} / 2")
+        math(EXPR solid "${tile} % 2")
+        list(GET piece_names ${piece} name)
+        if(solid EQUAL 1)
+            string(APPEND text "; ${name}, solid\n")
+        else()
+            string(APPEND text "; ${name}, outline\n")
+        endif()
+        byte_lines(tile_${tile} lines)
+        string(APPEND text "${lines}")
+    endforeach()
+endif()
+
+file(WRITE ${OUTPUT} "${text}")
@@ -40,6 +40,13 @@ function(_retromate_add_sdl2_target)
         DEPENDS ${target_variant}
         COMMENT "Running SDL2 target: $<TARGET_FILE:${target_variant}>"
     )
+
+    # Headless board redraw timing, using the software renderer
+    add_custom_target(${target_variant}_bench
+        COMMAND ${CMAKE_COMMAND} -E env SDL_VIDEODRIVER=dummy RETROMATE_BENCH_FRAMES=1000 $<TARGET_FILE:${target_variant}>
+        DEPENDS ${target_variant}
+        COMMENT "Timing board redraws: $<TARGET_FILE:${target_variant}>"
+    )
 endfunction()
 
 # --- Special function to add mac68k ---
@@ -87,11 +94,53 @@ function(_download_ip65 TARGET_NAME OUT_INCLUDE OUT_LIBS OUT_DEPFILE)
     set(${OUT_DEPFILE} ${IP65_DEP} PARENT_SCOPE)
 endfunction()
 
+# --- retromate_gen_pieces(target, out_file) ---
+# Make the target's hires_pieces from assets/pieces.txt, at build time.  The
+# <target>_pieces target stops the variants generating it at the same time
+function(retromate_gen_pieces TARGET_NAME OUT_FILE)
+    set(pieces_file ${CMAKE_BINARY_DIR}/gen/pieces_${TARGET_NAME}.s)
+
+    add_custom_command(
+        OUTPUT ${pieces_file}
+        COMMAND ${CMAKE_COMMAND}
+            -DPLATFORM=${TARGET_NAME}
+            -DART=${CMAKE_SOURCE_DIR}/assets/pieces.txt
+            -DOUTPUT=${pieces_file}
+            -P ${CMAKE_SOURCE_DIR}/cmake/GenPieces.cmake
+        DEPENDS ${CMAKE_SOURCE_DIR}/assets/pieces.txt ${CMAKE_SOURCE_DIR}/cmake/GenPieces.cmake ${CMAKE_SOURCE_DIR}/cmake/AsmBytes.cmake
+        COMMENT "Generating pieces for ${TARGET_NAME}"
+        VERBATIM
+    )
+    add_custom_target(${TARGET_NAME}_pieces DEPENDS ${pieces_file})
+
+    set(${OUT_FILE} ${pieces_file} PARENT_SCOPE)
+endfunction()
+
+# --- retromate_gen_charmaps(target, out_file) ---
+# Make the target's 256 byte text translation tables, at build time
+function(retromate_gen_charmaps TARGET_NAME OUT_FILE)
+    set(charmaps_file ${CMAKE_BINARY_DIR}/gen/charmaps_${TARGET_NAME}.s)
+
+    add_custom_command(
+        OUTPUT ${charmaps_file}
+        COMMAND ${CMAKE_COMMAND}
+            -DPLATFORM=${TARGET_NAME}
+            -DOUTPUT=${charmaps_file}
+            -P ${CMAKE_SOURCE_DIR}/cmake/GenCharmaps.cmake
+        DEPENDS ${CMAKE_SOURCE_DIR}/cmake/GenCharmaps.cmake ${CMAKE_SOURCE_DIR}/cmake/AsmBytes.cmake
+        COMMENT "Generating charmaps for ${TARGET_NAME}"
+        VERBATIM
+    )
+    add_custom_target(${TARGET_NAME}_charmaps DEPENDS ${charmaps_file})
+
+    set(${OUT_FILE} ${charmaps_file} PARENT_SCOPE)
+endfunction()
+
 # --- add_retromate_target(...) ---
 function(add_retromate_target)
     cmake_parse_arguments(ARG
         ""
-        "TARGET;VARIANT;PROG_FILE;DISK_FILE"
+        "TARGET;VARIANT;PROG_FILE;DISK_FILE;NETWORK"
         "SOURCES;COMPILE_DEFINITIONS;TEST_USING"
         ${ARGN})
 
@@ -108,6 +157,13 @@ function(add_retromate_target)
     set(variant ${ARG_VARIANT})
     set(target_variant ${target}_${variant})
 
+    # The network stack is named by the variant, unless given
+    if(ARG_NETWORK)
+        set(network ${ARG_NETWORK})
+    else()
+        set(network ${variant})
+    endif()
+
     # Get names sorted
     if(target STREQUAL "c64")
         set(prog_ext "prg")
@@ -196,7 +252,7 @@ function(add_retromate_target)
     set(IP65_INCLUDE_FLAG "")
     set(IP65_LIBS_FLAG "")
     set(IP65_DEPENDS "")
-    if("${variant}" STREQUAL "ip65")
+    if("${network}" STREQUAL "ip65")
         _download_ip65(${target} ip65_includes ip65_libs ip65_depfile)
         set(IP65_INCLUDE_FLAG -I${ip65_includes})
         set(IP65_LIBS_FLAG ${ip65_libs})
@@ -225,6 +281,12 @@ function(add_retromate_target)
         DEPENDS ${disk_file}
         VERBATIM
     )
+    if(TARGET ${target}_pieces)
+        add_dependencies(${target_variant} ${target}_pieces)
+    endif()
+    if(TARGET ${target}_charmaps)
+        add_dependencies(${target_variant} ${target}_charmaps)
+    endif()
 
     # Make the disks per platform
     if(target STREQUAL "c64")
@@ -266,10 +328,20 @@ function(add_retromate_target)
             COMMENT "Disk image: ${disk_file_name}"
             VERBATIM
         )
+    elseif(target STREQUAL "sim6502")
+        # sim65 runs the program as is, so the "disk" only marks it built
+        add_custom_command(
+            OUTPUT ${disk_file}
+            COMMAND ${CMAKE_COMMAND} -E touch ${disk_file}
+            DEPENDS ${prog_file}
+            COMMENT "No disk for sim6502: ${prog_file_name}"
+            VERBATIM
+        )
     else()
         add_custom_command(
             OUTPUT ${disk_file}
             COMMAND ${CMAKE_COMMAND} -E echo "Not making a disk for unknown target '${target}'"
+            DEPENDS ${prog_file}
             COMMENT "No disk image rule for target '${target}'"
             VERBATIM
         )
@@ -284,6 +356,18 @@ function(add_retromate_target)
         set(test_command ${X64_EXECUTABLE} -autostart ${PROG_REL_PATH})
     elseif(target STREQUAL "atarixl")
         set(test_command ${ATARI_EXECUTABLE} ${PROG_REL_PATH})
+    elseif(target STREQUAL "sim6502" AND variant STREQUAL "replay")
+        # Replay every capture.  A failed check fails the target
+        file(GLOB captures ${CMAKE_SOURCE_DIR}/assets/captures/*.fics)
+        foreach(capture ${captures})
+            if(test_command)
+                list(APPEND test_command COMMAND)
+            endif()
+            list(APPEND test_command ${SIM65_EXECUTABLE} -c ${prog_file} ${capture})
+        endforeach()
+    elseif(target STREQUAL "sim6502")
+        # Runs by itself, and the exit code passes or fails the target
+        set(test_command ${SIM65_EXECUTABLE} -c ${prog_file})
     else()
         message(STATUS "No test command available for target '${target}', variant '${variant}'")
     endif()
@@ -296,5 +380,6 @@ function(add_retromate_target)
             COMMENT "Running test for ${test_command}"
             VERBATIM
         )
+        add_dependencies(${target_variant}_test ${target_variant})
     endif()
 endfunction()
@@ -27,6 +27,8 @@ static void app_terminal() {
     char command[COMMAND_LENGTH] = {0};
     // Go to terminal mode
     plat_core_active_term(true);
+    // Copy in the text that arrived while the terminal was hidden
+    log_commit(&global.view.terminal);
     // Force a draw
     global.view.terminal.modified = true;
     // Run the input while updating the terminal and net
@@ -43,6 +45,16 @@ static void app_terminal() {
     }
 }
 
+/*-----------------------------------------------------------------------*/
+void app_connect() {
+    // Hide the menu
+    global.view.mc.df |= MENU_DRAW_HIDDEN;
+    // Make the terminal active
+    plat_core_active_term(true);
+    // Start the connection
+    fics_init();
+}
+
 /*-----------------------------------------------------------------------*/
 void app_draw_update() {
     if (global.view.terminal_active) {
@@ -52,16 +64,39 @@ void app_draw_update() {
     } else {
         // Board needs to be updated
         if (global.view.refresh) {
+            PERF_SPAN_BEGIN(PERF_SPAN_BOARD);
             global.state.prev_cursor = -1;
             plat_draw_board();
             if (global.view.info_panel.modified) {
                 plat_draw_log(&global.view.info_panel, plat_core_get_status_x(), 0, true);
             }
+#ifdef RETROMATE_ENGINE
+            // The engine rows go over the bottom of the info panel
+            engine.panel.modified = true;
+#endif
+#ifdef RETROMATE_BOOK
+            book.panel.modified = true;
+#endif
+            PERF_SPAN_END(PERF_SPAN_BOARD);
+            PERF_MOVE(PERF_MOVE_DRAWN);
             // If the menu is not hideen, it also needs to draw, on top
             // of the updated board
             if (!(global.view.mc.df & MENU_DRAW_HIDDEN)) {
                 global.view.mc.df = MENU_DRAW;
             }
+        } else if (global.view.info_panel.modified) {
+            // The same position again, with new clocks
+            plat_draw_log(&global.view.info_panel, plat_core_get_status_x(), 0, true);
+#ifdef RETROMATE_ENGINE
+            engine.panel.modified = true;
+#endif
+#ifdef RETROMATE_BOOK
+            book.panel.modified = true;
+#endif
+            // The menu may reach over the info panel
+            if (!(global.view.mc.df & MENU_DRAW_HIDDEN)) {
+                global.view.mc.df = MENU_DRAW;
+            }
         }
 
         // Update cursor and selection if needed
@@ -82,6 +117,12 @@ void app_draw_update() {
             }
             global.state.prev_cursor = global.state.cursor;
         }
+#ifdef RETROMATE_ENGINE
+        engine_draw_update();
+#endif
+#ifdef RETROMATE_BOOK
+        book_draw_update();
+#endif
     }
 }
 
@@ -108,6 +149,12 @@ void app_set_state(uint8_t new_state) {
             if (ui_pregame_menu_options_menu.menu_items[UI_LOGIN_OPTIONS_REGISTERED].selected != 1) {
                 strcpy(global.ui.user_name, "Guest");
             };
+#ifdef RETROMATE_ENGINE
+            engine_clear();
+#endif
+#ifdef RETROMATE_BOOK
+            book_clear();
+#endif
             // Bring up the pre-game (offline) UI
             menu_set(&ui_pregame_menu);
             plat_core_active_term(false);
@@ -157,12 +204,9 @@ void app_state_offline() {
             // user quit app (closed window or some quit hotkey)
             global.app.quit = true;
         } else if (global.app.selection == UI_MENU_MAIN_PLAY) {
-            // Hide the menu
-            global.view.mc.df |= MENU_DRAW_HIDDEN;
-            // Make the terminal active
-            plat_core_active_term(true);
-            // Start the connection
-            fics_init();
+            // Keep what was set up for next time
+            config_save();
+            app_connect();
         }
     }
 
@@ -189,18 +233,33 @@ void app_state_online() {
                 fics_play(global.setup.use_seek);
                 break;
 
+            case UI_MENU_INGAME_OBSERVE:
+                // The observe menu shows once the games list is in
+                games_request();
+                break;
+
+            case UI_MENU_INGAME_ARCHIVE:
+#ifdef RETROMATE_ARCHIVE
+                archive_list();
+#endif
+                break;
+
             case UI_MENU_INGAME_RESIGN:
                 plat_net_send("resign");
                 break;
 
+            case UI_MENU_INGAME_DRAW:
+                // The server allows the draw if the position came up 3 times
+                plat_net_send("draw");
+                break;
+
             case UI_MENU_INGAME_UNOBSERVE:
                 plat_net_send("unobserve");
                 break;
 
             case UI_MENU_INGAME_STOP_SEEK:
-                ui_in_game_menu.menu_items[UI_MENU_INGAME_NEW].item_state = MENU_STATE_ENABLED;
-                ui_in_game_menu.menu_items[UI_MENU_INGAME_STOP_SEEK].item_state = MENU_STATE_HIDDEN;
-                global.view.mc.df = MENU_DRAW_REDRAW;
+                menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_NEW, MENU_STATE_ENABLED);
+                menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_STOP_SEEK, MENU_STATE_HIDDEN);
                 plat_net_send("unseek");
                 break;
 
@@ -226,10 +285,8 @@ void app_state_online() {
             // So there's no extra erase call
             global.view.mc.df |= MENU_DRAW_ERASE;
             menu_set(&ui_in_game_menu);
-        } else if (global.state.includes_me) {
-            // I am a participant in this app, there's a cursor
-            app_user_input();
         }
+        // Anything else already went to app_user_input, from main
     }
 
     // On TAB, switch to terminal, whether menu is up or not
@@ -240,7 +297,26 @@ void app_state_online() {
 }
 
 /*-----------------------------------------------------------------------*/
+// Called as soon as the input is read, so a move is sent before the frame
+// draws anything.  Only while playing with the menu hidden - when it was
+// hidden coming into the frame, menu_tick doesn't look at the input
 void app_user_input() {
+    // With no game on, the cursor keys step through the last one
+    if (global.app.state == APP_STATE_ONLINE && (global.view.mc.df & MENU_DRAW_HIDDEN) && !global.state.game_active && !global.view.terminal_active) {
+        if (global.os.input_event.code == INPUT_LEFT || global.os.input_event.code == INPUT_RIGHT) {
+#ifdef RETROMATE_ARCHIVE
+            archive_step(global.os.input_event.code == INPUT_RIGHT);
+#else
+            review_step(global.os.input_event.code == INPUT_RIGHT);
+#endif
+            return;
+        }
+    }
+    if (global.app.state != APP_STATE_ONLINE || !(global.view.mc.df & MENU_DRAW_HIDDEN) || !global.state.includes_me) {
+        // Not a participant in a game, so there's no cursor
+        return;
+    }
+
     if (global.os.input_event.code == INPUT_MOUSE_MOVE || global.os.input_event.code == INPUT_MOUSE_CLICK) {
         uint8_t cursor = plat_core_mouse_to_cursor();
         if (cursor < 64) {
@@ -333,6 +409,7 @@ void app_user_input() {
                         global.state.move_str[3] = 'a' + (global.state.selector[1] & 7);
                         global.state.move_str[4] = '8' - (global.state.selector[1] / 8);
                         plat_net_send(global.state.move_str);
+                        PERF_SPAN_END(PERF_SPAN_INPUT);
                     }
                     global.state.selector_index = 0;
                     plat_draw_square(global.state.selector[0]);
@@ -16,6 +16,7 @@ enum {
     APP_STATE_ONLINE,
 };
 
+void app_connect(void);
 void app_draw_update(void);
 void app_error(bool fatal, const char *error_text);
 void app_set_state(uint8_t new_state);
@@ -0,0 +1,121 @@
+;
+; benchA2.s
+; RetroMate
+;
+; Created by Stefan Wessels, 2025.
+; This is free and unencumbered software released into the public domain.
+;
+; The Apple II has no timer, so the _bench build uses the first 6522 of a
+; Mockingboard.  Timer 1 free runs from $FFFF and its underflows, counted
+; in the IRQ, make up the top 16 bits
+;
+
+.include "zeropage.inc"
+
+.export _plat_core_bench_start, _plat_core_bench_cycles
+.interruptor bench_irq
+
+MB_SLOT     = 4             ; AppleWin's default Mockingboard slot
+
+via         = $C000 + MB_SLOT * $100
+via_t1cl    = via+4         ; counter lo (reading clears the IRQ)
+via_t1ch    = via+5         ; counter hi
+via_t1ll    = via+6         ; latch lo
+via_t1lh    = via+7         ; latch hi
+via_acr     = via+11        ; auxiliary control
+via_ifr     = via+13        ; interrupt flags
+via_ier     = via+14        ; interrupt enable
+
+.code
+
+; void plat_core_bench_start(void)
+.proc _plat_core_bench_start
+    sei
+    lda #0
+    sta underflows
+    sta underflows+1
+    lda #%01000000          ; timer 1 free running, PB7 off
+    sta via_acr
+    lda #$FF
+    sta via_t1ll
+    sta via_t1lh
+    sta via_t1cl
+    sta via_t1ch            ; load the counter from the latch and start
+    lda #%11000000          ; timer 1 IRQ on
+    sta via_ier
+    sta running
+    cli
+    rts
+.endproc
+
+; uint32_t plat_core_bench_cycles(void) - cycles since _plat_core_bench_start
+; Reading the counter clears the timer's IRQ, so with IRQs off, an underflow
+; that is pending when the counter is read is counted here instead
+.proc _plat_core_bench_cycles
+    php
+    sei
+    lda via_ifr
+    and #%01000000
+    sta tmp1                ; an underflow the IRQ hasn't counted
+    ldx via_t1ch
+    lda via_t1cl            ; clears the flag
+    ldy via_t1ch
+    sta tmp2
+    stx tmp3
+    cpy tmp3
+    beq hi_read
+    lda tmp2                ; lo wrapped between the hi reads.  A high lo
+    bpl hi_read             ; was read after the borrow, so goes with the
+    sty tmp3                ; second hi
+hi_read:
+    lda tmp1
+    bne count
+    lda tmp3                ; the flag was clear, but an underflow between
+    cmp #$FF                ; reading it and the counter leaves the counter
+    bne done                ; just below $FFFF, and the flag cleared.  One
+    lda tmp2                ; the IRQ counted is long past that
+    cmp #$E0
+    bcc done
+count:
+    inc underflows
+    bne done
+    inc underflows+1
+done:
+    lda underflows
+    sta sreg
+    lda underflows+1
+    sta sreg+1
+    plp
+
+    lda tmp2                ; the timer counts down
+    eor #$FF
+    pha
+    lda tmp3
+    eor #$FF
+    tax
+    pla
+    rts
+.endproc
+
+; Count timer 1 underflows.  Carry set if it was the timer's IRQ
+.proc bench_irq
+    lda running
+    beq not_mine            ; no Mockingboard has been set up
+    lda via_ifr
+    and #%01000000
+    beq not_mine
+    lda via_t1cl            ; acknowledge
+    inc underflows
+    bne :+
+    inc underflows+1
+:   sec
+    rts
+not_mine:
+    clc
+    rts
+.endproc
+
+.data
+
+running:    .byte $00
+underflows: .word $0000
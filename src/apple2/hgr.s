@@ -1,2 +1,5 @@
 .segment "HGR"
 .incbin "retromate.hgr"
+.ifdef A2_PAGE_FLIP
+.res $2000                  ; HGR page 2, so the code starts at $6000
+.endif
@@ -6,8 +6,11 @@
 ;
 ;
 
-.export _hires_char_set, _hires_pieces
+.export _hires_char_set
 .export _hires_init, _hires_done, _hires_draw, _hires_mask
+.ifdef A2_PAGE_FLIP
+.export _hires_flip, _hires_copy
+.endif
 
 .include "apple2.inc"
 .include "zeropage.inc"
@@ -33,9 +36,6 @@ BASEHI:
 _hires_char_set:
 .incbin "charset.bin"
 
-_hires_pieces:
-.incbin "pieces.bin"
-
 
 .code
 
@@ -56,6 +56,10 @@ _hires_pieces:
         bit     TXTCLR
         bit     MIXCLR
         bit     HIRES
+.ifdef A2_PAGE_FLIP
+        sta     CLR80COL    ; So PAGE2 picks the page, not main/aux
+        jsr     show_page
+.endif
 
         lda     #20
         sta     WNDTOP      ; Prepare hires_text()
@@ -67,6 +71,9 @@ _hires_pieces:
 .proc   _hires_done
 
         bit     TXTSET
+.ifdef A2_PAGE_FLIP
+        bit     LOWSCR      ; The text is on page 1
+.endif
 
         lda     #00
         sta     WNDTOP      ; Back to full screen text
@@ -110,6 +117,9 @@ yloop:
         lda     BASELO,x
         sta     dst+1
         lda     BASEHI,x
+.ifdef A2_PAGE_FLIP
+        eor     draw_page
+.endif
         sta     dst+2
 
 xpos:   ldx     #$FF        ; Patched
@@ -162,6 +172,9 @@ yloop:
         sta     src+1
         sta     dst+1
         lda     BASEHI,x
+.ifdef A2_PAGE_FLIP
+        eor     draw_page
+.endif
         sta     src+2
         sta     dst+2
 
@@ -181,3 +194,87 @@ ymax:   cpx     #$FF        ; Patched
         rts
 
 .endproc
+
+
+.ifdef A2_PAGE_FLIP
+
+; BASEHI is page 1.  EOR with this is the page drawn on: $60 for page 2,
+; while page 1 shows, or $00 for page 1, while page 2 shows
+draw_page:
+        .byte   $60
+
+
+.proc   _hires_copy
+
+        jsr     popa        ; 'ysize'
+        sta     ymax+1
+
+        jsr     popa        ; 'xsize'
+        sta     xmax+1
+
+        jsr     popa        ; 'ypos'
+        tax
+
+        clc
+        adc     ymax+1
+        sta     ymax+1
+
+        jsr     popa        ; 'xpos'
+        sta     xpos+1
+
+        clc
+        adc     xmax+1
+        sta     xmax+1
+
+yloop:
+        lda     BASELO,x
+        sta     src+1
+        sta     dst+1
+        lda     BASEHI,x
+        eor     draw_page
+        sta     dst+2
+        eor     #$60        ; The page that shows
+        sta     src+2
+
+xpos:   ldy     #$FF        ; Patched
+xloop:
+src:    lda     $FFFF,y     ; Patched
+dst:    sta     $FFFF,y     ; Patched
+        iny
+xmax:   cpy     #$FF        ; Patched
+        bne     xloop
+
+        inx
+ymax:   cpx     #$FF        ; Patched
+        bne     yloop
+        rts
+
+.endproc
+
+
+.code
+
+
+; Show the page that was drawn on, and draw on the other one from now on
+.proc   _hires_flip
+
+        lda     draw_page
+        eor     #$60
+        sta     draw_page
+        ; Fall through
+
+.endproc
+
+
+.proc   show_page
+
+        lda     draw_page
+        bne     :+
+        bit     HISCR       ; Drawing on page 1, so page 2 shows
+        rts
+:       bit     LOWSCR
+        rts
+
+.endproc
+
+.endif
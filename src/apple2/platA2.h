@@ -10,6 +10,8 @@
 #ifndef _PLATA2_H_
 #define _PLATA2_H_
 
+#include <em.h>         // struct em_copy
+
 /*-----------------------------------------------------------------------*/
 #define CLR80COL    0xC001
 #define SET80COL    0xC001
@@ -30,6 +32,9 @@
 #define SQUARE_DISPLAY_HEIGHT   22
 #define BOARD_DISPLAY_HEIGHT    (SQUARE_DISPLAY_HEIGHT * 8)
 
+// The settings, in the ProDOS prefix it was started from
+#define CONFIG_FILE_NAME        "RETROMATE.CFG"
+
 #define ROP_CONST(val)          0xA980|(val)
 #define ROP_BLACK               0xA980
 #define ROP_WHITE               0xA9FF
@@ -38,6 +43,11 @@
 #define ROP_INV                 0x49FF
 #define ROP_AND(val)            0x2900|(val)
 
+// Terminal history rows in aux memory, 3 to a 256 byte page.  The driver's
+// page 0 is aux $0200, and aux $0400-$07FF is the 80 column screen
+#define HISTORY_ROWS_PER_PAGE   (256 / LOG_HISTORY_COLS)
+#define HISTORY_FIRST_PAGE      6
+
 extern char hires_char_set[96][CHARACTER_HEIGHT];
 extern char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT];
 
@@ -51,6 +61,21 @@ void hires_mask(char xpos,    char ypos,
                 char xsize,   char ysize,
                 unsigned rop);
 
+#ifdef A2_PAGE_FLIP
+// Drawing goes to the hidden HGR page.  plat_draw_update flips, then copies
+// the areas drawn since the last flip back over, so the pages stay the same
+void hires_flip(void);
+void hires_copy(char xpos,    char ypos,
+                char xsize,   char ysize);
+
+#define DIRTY_MAX               8
+
+// x and w in bytes (7 pixels), y and h in pixel rows
+typedef struct _dirty {
+    uint8_t x, y, w, h;
+} dirty_t;
+#endif
+
 
 typedef struct _apple2 {
     char rop_line[2][7];
@@ -62,6 +87,12 @@ typedef struct _apple2 {
     char send_buffer[80];
     char terminal_log_buffer[80 * 23];
     char status_log_buffer[13 * 24];
+    struct em_copy history_copy;
+    char history_row[80];
+#ifdef A2_PAGE_FLIP
+    dirty_t dirty[DIRTY_MAX];
+    uint8_t dirty_count;
+#endif
 } apple2_t;
 
 extern apple2_t apple2;
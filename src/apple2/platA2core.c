@@ -9,8 +9,10 @@
 
 #include <apple2.h>
 #include <conio.h>  // kbhit, cgetc
+#include <fcntl.h>  // open
 #include <stdlib.h> // exit
 #include <string.h> // memcpy
+#include <unistd.h> // read, write, close
 
 #include "../global.h"
 
@@ -32,6 +34,29 @@ void plat_core_active_term(bool active) {
     }
 }
 
+/*-----------------------------------------------------------------------*/
+bool plat_core_config_load(void *data, uint8_t size) {
+    int fd = open(CONFIG_FILE_NAME, O_RDONLY);
+    bool loaded;
+
+    if (fd < 0) {
+        return false;
+    }
+    loaded = read(fd, data, size) == size;
+    close(fd);
+    return loaded;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_config_save(const void *data, uint8_t size) {
+    int fd = open(CONFIG_FILE_NAME, O_WRONLY | O_CREAT | O_TRUNC);
+
+    if (fd >= 0) {
+        write(fd, data, size);
+        close(fd);
+    }
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_core_copy_ascii_to_display(void *dest, const void *src, size_t n) {
     memcpy(dest, src, n);
@@ -61,6 +86,44 @@ uint8_t plat_core_get_status_x(void) {
     return 3 + SQUARE_TEXT_WIDTH * 8;
 }
 
+/*-----------------------------------------------------------------------*/
+// Point the aux memory copy at a history slot, past the 80 column screen
+static void plat_core_history_slot(uint16_t slot, const char *buf) {
+    apple2.history_copy.buf = (void *)buf;
+    apple2.history_copy.page = HISTORY_FIRST_PAGE + slot / HISTORY_ROWS_PER_PAGE;
+    apple2.history_copy.offs = (slot % HISTORY_ROWS_PER_PAGE) * LOG_HISTORY_COLS;
+    apple2.history_copy.count = LOG_HISTORY_COLS;
+}
+
+/*-----------------------------------------------------------------------*/
+const char *plat_core_history_get(uint16_t slot) {
+    plat_core_history_slot(slot, apple2.history_row);
+    em_copyfrom(&apple2.history_copy);
+    return apple2.history_row;
+}
+
+/*-----------------------------------------------------------------------*/
+// The terminal history lives in the 64K aux memory of a //e or IIgs, if the
+// driver finds an extended 80 column card.  Without, there's just the screen
+uint16_t plat_core_history_init(void) {
+    unsigned pages;
+
+    if (get_ostype() < APPLE_IIE || em_install(a2_auxmem_emd) != EM_ERR_OK) {
+        return 0;
+    }
+    pages = em_pagecount();
+    if (pages <= HISTORY_FIRST_PAGE) {
+        return 0;
+    }
+    return (pages - HISTORY_FIRST_PAGE) * HISTORY_ROWS_PER_PAGE;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_history_put(uint16_t slot, const char *row) {
+    plat_core_history_slot(slot, row);
+    em_copyto(&apple2.history_copy);
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_core_init() {
     uint8_t i, j;
@@ -143,6 +206,8 @@ uint8_t plat_core_key_input(input_event_t *evt) {
 
 /*-----------------------------------------------------------------------*/
 void plat_core_key_wait_any() {
+    // Whatever was drawn has to show before waiting on it
+    plat_draw_update();
     while (kbhit()) {
         cgetc();
     }
@@ -125,6 +125,49 @@ apple2_t apple2 = {
 
 #pragma code-name(push, "LC")
 
+#ifdef A2_PAGE_FLIP
+/*-----------------------------------------------------------------------*/
+// Note an area drawn on the hidden page.  Once the list is full, the area
+// goes into whichever entry grows the least by taking it in
+static void plat_draw_dirty(uint8_t x, uint8_t y, uint8_t w, uint8_t h) {
+    uint8_t i, l, t, r, b;
+    uint16_t area, best_area = 0xFFFF;
+    dirty_t *d, *best = apple2.dirty;
+
+    if (!w || !h) {
+        return;
+    }
+    if (apple2.dirty_count < DIRTY_MAX) {
+        d = &apple2.dirty[apple2.dirty_count++];
+        d->x = x;
+        d->y = y;
+        d->w = w;
+        d->h = h;
+        return;
+    }
+    for (i = 0, d = apple2.dirty; i < DIRTY_MAX; i++, d++) {
+        l = MIN(d->x, x);
+        t = MIN(d->y, y);
+        r = MAX(d->x + d->w, x + w);
+        b = MAX(d->y + d->h, y + h);
+        area = (r - l) * (b - t) - d->w * d->h;
+        if (area < best_area) {
+            best_area = area;
+            best = d;
+        }
+    }
+    r = MAX(best->x + best->w, x + w);
+    b = MAX(best->y + best->h, y + h);
+    best->x = MIN(best->x, x);
+    best->y = MIN(best->y, y);
+    best->w = r - best->x;
+    best->h = b - best->y;
+}
+#define DIRTY(x, y, w, h)   plat_draw_dirty(x, y, w, h)
+#else
+#define DIRTY(x, y, w, h)
+#endif
+
 /*-----------------------------------------------------------------------*/
 // x in Character coords, y in Graphics coords
 static void plat_draw_char(char x, char y, unsigned rop, char c) {
@@ -144,11 +187,13 @@ void plat_draw_background() {
 
     // If the accoutrements are covered
     if (global.view.mc.x < 2) {
+        DIRTY(0, 0, 2, SCREEN_DISPLAY_HEIGHT);
         hires_mask(0, 0, 2, SCREEN_DISPLAY_HEIGHT, ROP_BLACK);
     }
 
     if (x > 0) {
         // The menu covers part of the status area - clear it
+        DIRTY(r, global.view.mc.y * CHARACTER_HEIGHT, x, global.view.mc.h * CHARACTER_HEIGHT);
         hires_mask(r, global.view.mc.y * CHARACTER_HEIGHT, x, global.view.mc.h  * CHARACTER_HEIGHT, ROP_BLACK);
         plat_draw_log(&global.view.info_panel, plat_core_get_status_x(), 0, true);
     }
@@ -187,12 +232,18 @@ void plat_draw_board_accoutrements() {
     char i;
 
     // Draw the board border
+    DIRTY(1, 0, 1, 8 * SQUARE_DISPLAY_HEIGHT + 2 * 2);
+    DIRTY(26, 0, 1, 8 * SQUARE_DISPLAY_HEIGHT + 2 * 2);
+    DIRTY(2, 0, 8 * SQUARE_TEXT_WIDTH, 2);
+    DIRTY(2, 178, 8 * SQUARE_TEXT_WIDTH, 2);
     hires_mask(1, 0, 1, 8 * SQUARE_DISPLAY_HEIGHT + 2 * 2, ROP_CONST(apple2.rop_line[1][2]));
     hires_mask(26, 0, 1, 8 * SQUARE_DISPLAY_HEIGHT + 2 * 2, ROP_CONST(apple2.rop_line[0][2]));
     hires_mask(2, 0, 8 * SQUARE_TEXT_WIDTH, 2, ROP_WHITE);
     hires_mask(2, 178, 8 * SQUARE_TEXT_WIDTH, 2, ROP_WHITE);
 
     // Add the A..H and 1..8 tile-keys
+    DIRTY(3, 184, 8 * SQUARE_TEXT_WIDTH, CHARACTER_HEIGHT);
+    DIRTY(0, 0, 1, SCREEN_DISPLAY_HEIGHT);
     for (i = 0; i < 8; ++i) {
         plat_draw_char(3 + i * SQUARE_TEXT_WIDTH, 184, ROP_CPY, i + 'A');
         plat_draw_char(0, SCREEN_DISPLAY_HEIGHT - 29 - i * SQUARE_DISPLAY_HEIGHT, ROP_CPY, i + '1');
@@ -215,12 +266,15 @@ void plat_draw_clear_input_line(bool) {
     if (global.view.terminal_active) {
         cclearxy(0, SCREEN_TEXT_HEIGHT - 1, apple2.terminal_display_width);
     } else {
+        DIRTY(0, (SCREEN_TEXT_HEIGHT - 1) * CHARACTER_HEIGHT, SCREEN_TEXT_WIDTH, CHARACTER_HEIGHT);
         hires_mask(0, (SCREEN_TEXT_HEIGHT - 1) * CHARACTER_HEIGHT, SCREEN_TEXT_WIDTH, CHARACTER_HEIGHT, ROP_BLACK);
     }
 }
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_clear_statslog_area(uint8_t row) {
+    DIRTY(plat_core_get_status_x(), CHARACTER_HEIGHT * row,
+          global.view.info_panel.cols, CHARACTER_HEIGHT * (SCREEN_TEXT_HEIGHT - row));
     hires_mask(plat_core_get_status_x(), CHARACTER_HEIGHT * row,
                global.view.info_panel.cols, CHARACTER_HEIGHT * (SCREEN_TEXT_HEIGHT - row),
                ROP_BLACK);
@@ -229,6 +283,7 @@ void plat_draw_clear_statslog_area(uint8_t row) {
 /*-----------------------------------------------------------------------*/
 void plat_draw_clrscr() {
     clrscr();
+    DIRTY(0, 0, SCREEN_TEXT_WIDTH, SCREEN_DISPLAY_HEIGHT);
     hires_mask(0, 0, SCREEN_TEXT_WIDTH, SCREEN_DISPLAY_HEIGHT, ROP_BLACK);
 }
 
@@ -238,6 +293,7 @@ void plat_draw_highlight(uint8_t position, uint8_t color) {
     uint8_t x = position & 7;
     bool black_or_white = !((x & 1) ^ (y & 1));
 
+    DIRTY(2 + x * SQUARE_TEXT_WIDTH, 2 + y * SQUARE_DISPLAY_HEIGHT, SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT);
     if (color) {
         hires_mask(2 + x * SQUARE_TEXT_WIDTH, 2 + y * SQUARE_DISPLAY_HEIGHT + SQUARE_DISPLAY_HEIGHT/3, SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT/2-2, ROP_INV);
     } else {
@@ -248,14 +304,10 @@ void plat_draw_highlight(uint8_t position, uint8_t color) {
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool) {
-    int i;
-    char *log_end = log->buffer + log->buffer_size;
-    char *log_render = log->buffer;
+    uint8_t i;
+    uint8_t pan = 0;
     uint8_t width = log->cols;
 
-    if (log->size >= log->rows) {
-        log_render += log->cols * log->head;
-    }
     log->modified = false;
 
     if (width > apple2.terminal_display_width) {
@@ -265,20 +317,17 @@ void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool) {
             global.view.pan_value = 0;
         }
         width = SCREEN_TEXT_WIDTH;
-        log_render += 20 * shift;
+        pan = 20 * shift;
     }
 
     for (i = 0; i < log->size; ++i) {
-        plat_draw_text(x, y++, log_render, width);
-        log_render += log->cols;
-        if (log_render >= log_end) {
-            log_render = log->buffer + (log_render - log_end);
-        }
+        plat_draw_text(x, y++, log_row(log, i) + pan, width);
     }
 }
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color) {
+    DIRTY(x, y * CHARACTER_HEIGHT, w, h * CHARACTER_HEIGHT);
     hires_mask(x, y * CHARACTER_HEIGHT, w, h * CHARACTER_HEIGHT, color ? ROP_WHITE : ROP_BLACK);
 }
 
@@ -321,6 +370,7 @@ void plat_draw_square(uint8_t position) {
         piece = 1;
     }
 
+    DIRTY(2 + x * SQUARE_TEXT_WIDTH, 2 + y * SQUARE_DISPLAY_HEIGHT, SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT);
     hires_draw(2 + x * SQUARE_TEXT_WIDTH, 2 + y * SQUARE_DISPLAY_HEIGHT,
                SQUARE_TEXT_WIDTH, SQUARE_DISPLAY_HEIGHT, rop,
                hires_pieces[(piece & 127) - 1][inv]);
@@ -337,6 +387,7 @@ void plat_draw_text(uint8_t x, uint8_t y, const char *text, uint8_t len) {
         }
     } else {
         y *= CHARACTER_HEIGHT;
+        DIRTY(x, y, len, CHARACTER_HEIGHT);
         while (len) {
             plat_draw_char(x++, y, ROP_CPY, *text);
             len--;
@@ -360,6 +411,7 @@ uint8_t plat_draw_ui_help_callback(menu_t *m, void *data) {
         plat_draw_rect(2, s, 37, h, 0);
 
         // Draw a frame
+        DIRTY(2, s*CHARACTER_HEIGHT, 37, h*CHARACTER_HEIGHT+2);
         hires_mask(2, s*CHARACTER_HEIGHT, 1, h*CHARACTER_HEIGHT+2, ROP_CONST(apple2.rop_line[0][2]));
         hires_mask(38, s*CHARACTER_HEIGHT, 1, h*CHARACTER_HEIGHT+2, ROP_CONST(apple2.rop_line[1][2]));
         hires_mask(2, s*CHARACTER_HEIGHT, 37, 2, ROP_WHITE);
@@ -380,6 +432,21 @@ uint8_t plat_draw_ui_help_callback(menu_t *m, void *data) {
 }
 
 /*-----------------------------------------------------------------------*/
+// Show what was drawn, and bring the page that's now hidden up to date.  Not
+// while the terminal (text page 1) shows - the flip waits for the board
 void plat_draw_update() {
+#ifdef A2_PAGE_FLIP
+    uint8_t i;
+    dirty_t *d;
+
+    if (!apple2.dirty_count || global.view.terminal_active) {
+        return;
+    }
+    hires_flip();
+    for (i = 0, d = apple2.dirty; i < apple2.dirty_count; i++, d++) {
+        hires_copy(d->x, d->y, d->w, d->h);
+    }
+    apple2.dirty_count = 0;
+#endif
 }
 
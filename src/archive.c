@@ -0,0 +1,535 @@
+/*
+ *  archive.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "global.h"
+
+#ifdef RETROMATE_ARCHIVE
+
+// Server data, so ASCII encoded as hex (see fics.c)
+                                    // "-rnbqkp" - by the piece enum
+#define ARCHIVE_PIECE_LETTERS       "\x2d\x72\x6e\x62\x71\x6b\x70"
+
+archive_t archive;
+
+static const char *archive_results[] = {"*", "1-0", "0-1", "1/2"};
+static position_t archive_standard;
+
+/*-----------------------------------------------------------------------*/
+static uint32_t archive_get(const uint8_t *data, uint8_t size) {
+    uint32_t value = 0;
+    while (size--) {
+        value = (value << 8) | data[size];
+    }
+    return value;
+}
+
+/*-----------------------------------------------------------------------*/
+static void archive_put(uint8_t *data, uint32_t value, uint8_t size) {
+    while (size--) {
+        *data++ = value & 0xFF;
+        value >>= 8;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Put the piece on the 0x88 square sq of archive.review on the board.  True
+// if the board changed
+static bool archive_show_square(uint8_t sq) {
+    uint8_t i = (7 - MOVEGEN_RANK(sq)) * 8 + MOVEGEN_FILE(sq);
+    uint8_t piece = archive.review.board[sq];
+    char letter = ARCHIVE_PIECE_LETTERS[piece & ~PIECE_WHITE];
+
+    if (piece & PIECE_WHITE) {
+        letter -= 0x20;                     // To upper case
+    }
+    if (global.state.chess_board[i] == letter) {
+        return false;
+    }
+    zobrist_square(i, global.state.chess_board[i], letter);
+    global.state.chess_board[i] = letter;
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+static void archive_draw_square(uint8_t sq) {
+    if (archive_show_square(sq)) {
+        plat_draw_square((7 - MOVEGEN_RANK(sq)) * 8 + MOVEGEN_FILE(sq));
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// The rest of archive.review, into the frame as style 12 would have it
+static void archive_show_flags(void) {
+    const position_t *p = &archive.review;
+
+    // 'W' 'B'
+    global.frame.color_to_move[0] = p->side == SIDE_WHITE ? '\x57' : '\x42';
+    // '1' '0'
+    global.frame.w_can_castle_s[0] = p->castle & MOVEGEN_CASTLE_WK ? '\x31' : '\x30';
+    global.frame.w_can_castle_l[0] = p->castle & MOVEGEN_CASTLE_WQ ? '\x31' : '\x30';
+    global.frame.b_can_castle_s[0] = p->castle & MOVEGEN_CASTLE_BK ? '\x31' : '\x30';
+    global.frame.b_can_castle_l[0] = p->castle & MOVEGEN_CASTLE_BQ ? '\x31' : '\x30';
+    if (p->ep == MOVEGEN_NO_SQUARE) {
+        strcpy(global.frame.double_pawn_push, "\x2d\x31");                 // "-1"
+    } else {
+        global.frame.double_pawn_push[0] = '\x30' + MOVEGEN_FILE(p->ep);   // '0'
+        global.frame.double_pawn_push[1] = '\0';
+    }
+    zobrist_flags();
+#ifdef RETROMATE_ENGINE
+    engine_position();
+#endif
+#ifdef RETROMATE_BOOK
+    book_position();
+#endif
+}
+
+/*-----------------------------------------------------------------------*/
+// The game, and how far into it the board is
+static void archive_panel(void) {
+    char text[6];
+    tLog *panel = &global.view.info_panel;
+
+    log_clear(panel);
+    log_add_line(panel, global.frame.w_name, -1);
+    log_add_line(panel, global.frame.b_name, -1);
+    log_add_line(panel, archive_results[archive.result], -1);
+    log_add_line(panel, global.view.scratch_buffer,
+                 snprintf(global.view.scratch_buffer, sizeof(global.view.scratch_buffer), "Ply: %u/%u",
+                          (unsigned)archive.review_ply, (unsigned)archive.plies));
+    if (archive.review_ply) {
+        movegen_move_text(&archive.review_moves[archive.review_ply - 1], text);
+        log_add_line(panel, global.view.scratch_buffer,
+                     snprintf(global.view.scratch_buffer, sizeof(global.view.scratch_buffer), "%s%s", global.text.word_last, text));
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Play plies of moves from archive.start into archive.review, keeping what
+// it takes to step back.  Returns the plies that were good
+static uint16_t archive_replay(const uint8_t *moves, uint16_t plies) {
+    move_t list[MOVEGEN_MAX_MOVES];
+    uint16_t ply;
+    uint8_t count;
+
+    archive.review = archive.start;
+    for (ply = 0; ply < plies; ply++) {
+        count = movegen_generate(&archive.review, list);
+        if (moves[ply] >= count || !movegen_make(&archive.review, &list[moves[ply]], &archive.review_undo[ply])) {
+            break;
+        }
+        archive.review_moves[ply] = list[moves[ply]];
+        archive.moves[ply] = moves[ply];
+    }
+    archive.review_ply = ply;
+    archive.review_ready = true;
+    return ply;
+}
+
+/*-----------------------------------------------------------------------*/
+// A takeback.  Unmake the recorded plies, newest first, till the position is
+// target.  False if none of them lead there
+static bool archive_take_back(const position_t *target) {
+    uint16_t ply = archive_replay(archive.moves, archive.plies);
+
+    while (1) {
+        if (archive.review.side == target->side && !memcmp(archive.review.board, target->board, MOVEGEN_SQUARES)) {
+            break;
+        }
+        if (!ply) {
+            return false;
+        }
+        ply--;
+        movegen_unmake(&archive.review, &archive.review_moves[ply], &archive.review_undo[ply]);
+    }
+    // archive.review, and the moves up to it, are ready to step through
+    archive.plies = archive.review_ply = ply;
+    archive.position = archive.review;
+    if (ply < ARCHIVE_OPENING_PLY) {
+        archive.opening = ((uint64_t)zobrist.key.hi << 32) | zobrist.key.lo;
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+// Start recording at the position style 12 just brought in, unless movegen
+// can't work from it
+static void archive_start(void) {
+    strcpy(archive.game_number, global.frame.game_number);
+    archive.recording = movegen_set_frame(&archive.start, global.state.chess_board, &global.frame);
+    archive.position = archive.start;
+    archive.plies = 0;
+    archive.result = ARCHIVE_RESULT_NONE;
+    archive.review_ready = false;
+    archive.opening = ((uint64_t)zobrist.key.hi << 32) | zobrist.key.lo;
+    archive.played = 0;
+    if (global.state.includes_me) {
+        archive.played = global.state.my_side == SIDE_WHITE ? ARCHIVE_PLAYED_WHITE : ARCHIVE_PLAYED_BLACK;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// The rows for the games from archive.first, newest first
+static void archive_make_rows(void) {
+    char row[ARCHIVE_ROW_LEN + 1];
+    const uint8_t *index;
+    const uint8_t *record;
+    uint32_t size, game, count;
+    time_t date;
+    struct tm *tm;
+    uint8_t i, len;
+
+    index = plat_core_file_map(ARCHIVE_INDEX_FILE, &size);
+    if (!index) {
+        size = 0;
+    }
+    // Games still being appended aren't in the file yet
+    count = MIN(archive.count, size / ARCHIVE_INDEX_SIZE);
+    for (i = 0; i < ARCHIVE_MENU_ITEMS; i++) {
+        if (archive.first + i >= count) {
+            ui_archive_menu.menu_items[i].item_state = MENU_STATE_HIDDEN;
+            continue;
+        }
+        game = count - 1 - archive.first - i;
+        record = index + game * ARCHIVE_INDEX_SIZE;
+        date = archive_get(record + ARCHIVE_INDEX_DATE, 4);
+        tm = localtime(&date);
+        len = snprintf(row, sizeof(row), "%02d%02d%02d %-*.*s %-*.*s %s",
+                       tm ? tm->tm_year % 100 : 0, tm ? tm->tm_mon + 1 : 0, tm ? tm->tm_mday : 0,
+                       ARCHIVE_SHOWN_NAME_LEN, ARCHIVE_SHOWN_NAME_LEN, (const char *)record + ARCHIVE_INDEX_WHITE,
+                       ARCHIVE_SHOWN_NAME_LEN, ARCHIVE_SHOWN_NAME_LEN, (const char *)record + ARCHIVE_INDEX_BLACK,
+                       archive_results[record[ARCHIVE_INDEX_RESULT] & 3]);
+        plat_core_copy_ascii_to_display(archive.rows[i], row, len);
+        archive.rows[i][len] = '\0';
+        archive.shown[i] = game;
+        ui_archive_menu.menu_items[i].item_state = MENU_STATE_ENABLED;
+    }
+    if (index) {
+        plat_core_file_unmap(index, size);
+    }
+    ui_archive_menu.menu_items[UI_ARCHIVE_OLDER].item_state =
+        archive.first + ARCHIVE_MENU_ITEMS < count ? MENU_STATE_ENABLED : MENU_STATE_DISABLED;
+    ui_archive_menu.menu_items[UI_ARCHIVE_NEWER].item_state =
+        archive.first ? MENU_STATE_ENABLED : MENU_STATE_DISABLED;
+}
+
+/*-----------------------------------------------------------------------*/
+// The game-over message, from after the player names.  The result follows
+// the closing }
+void archive_game_over(const char *text, int len) {
+    uint8_t index[ARCHIVE_INDEX_SIZE];
+    uint8_t data[1 + ARCHIVE_SETUP_SIZE + ARCHIVE_PLIES_MAX];
+    uint8_t result = ARCHIVE_RESULT_NONE;
+    uint8_t i, sq, piece;
+    uint16_t length = 1;
+
+    if (!archive.recording) {
+        return;
+    }
+    archive.recording = false;
+    // The server reuses game numbers, so the next game with this one is new
+    archive.game_number[0] = '\0';
+    if (!archive.plies) {
+        return;
+    }
+
+    while (len > 0 && *text != '\x7d' && *text != '\x0a') {  // '}' '\n'
+        text++;
+        len--;
+    }
+    if (len >= 4 && *text == '\x7d') {
+        // "} 1-0" "} 0-1" "} 1/2-1/2"
+        if (text[2] == '\x30') {                // '0'
+            result = ARCHIVE_RESULT_BLACK;
+        } else if (text[2] == '\x31') {         // '1'
+            result = text[3] == '\x2f' ? ARCHIVE_RESULT_DRAW : ARCHIVE_RESULT_WHITE; // '/'
+        }
+    }
+
+    data[0] = 0;
+    if (memcmp(&archive.start, &archive_standard, sizeof(position_t))) {
+        // 2 squares a byte, a1 first, the piece enum with white as bit 3
+        data[0] = ARCHIVE_DATA_SETUP;
+        memset(&data[1], 0, 32);
+        for (i = 0; i < 64; i++) {
+            sq = MOVEGEN_SQUARE(i >> 3, i & 7);
+            piece = archive.start.board[sq];
+            data[1 + (i >> 1)] |= ((piece & 7) | (piece & PIECE_WHITE ? 8 : 0)) << ((i & 1) << 2);
+        }
+        data[33] = archive.start.side;
+        data[34] = archive.start.castle;
+        data[35] = archive.start.ep;
+        length += ARCHIVE_SETUP_SIZE;
+    }
+    memcpy(&data[length], archive.moves, archive.plies);
+    length += archive.plies;
+
+    memset(index, 0, sizeof(index));
+    archive_put(&index[ARCHIVE_INDEX_OFFSET], archive.data_size, 4);
+    archive_put(&index[ARCHIVE_INDEX_LENGTH], length, 2);
+    archive_put(&index[ARCHIVE_INDEX_PLIES], archive.plies, 2);
+    archive_put(&index[ARCHIVE_INDEX_DATE], (uint32_t)time(NULL), 4);
+    index[ARCHIVE_INDEX_RESULT] = result;
+    archive.result = result;
+    index[ARCHIVE_INDEX_PLAYED] = archive.played;
+    strncpy((char *)&index[ARCHIVE_INDEX_WHITE], global.frame.w_name, ARCHIVE_NAME_LEN);
+    strncpy((char *)&index[ARCHIVE_INDEX_BLACK], global.frame.b_name, ARCHIVE_NAME_LEN);
+    index[ARCHIVE_INDEX_TIME] = MIN(atoi(global.frame.initial_time), 255);
+    index[ARCHIVE_INDEX_INCREMENT] = MIN(atoi(global.frame.time_increment), 255);
+    archive_put(&index[ARCHIVE_INDEX_OPENING], (uint32_t)archive.opening, 4);
+    archive_put(&index[ARCHIVE_INDEX_OPENING + 4], (uint32_t)(archive.opening >> 32), 4);
+
+    // The platform writes, and syncs, on a thread
+    plat_core_file_append(ARCHIVE_DATA_FILE, data, length);
+    plat_core_file_append(ARCHIVE_INDEX_FILE, index, ARCHIVE_INDEX_SIZE);
+    archive.data_size += length;
+    archive.count++;
+}
+
+/*-----------------------------------------------------------------------*/
+void archive_init(void) {
+    const uint8_t *index, *record;
+    const uint8_t *data;
+    uint32_t index_size, data_size = 0, end = 0;
+
+    movegen_set_fen(&archive_standard, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+
+    if ((data = plat_core_file_map(ARCHIVE_DATA_FILE, &data_size))) {
+        plat_core_file_unmap(data, data_size);
+    }
+    // A crash mid-append can leave part of a record at the end of either
+    // file.  Games are synced before their index records, so only keep the
+    // records whose games are all there, and cut both files back to them, as
+    // later appends would otherwise land after the partial bytes
+    if ((index = plat_core_file_map(ARCHIVE_INDEX_FILE, &index_size))) {
+        archive.count = index_size / ARCHIVE_INDEX_SIZE;
+        while (archive.count) {
+            record = index + (archive.count - 1) * ARCHIVE_INDEX_SIZE;
+            end = archive_get(record + ARCHIVE_INDEX_OFFSET, 4) + archive_get(record + ARCHIVE_INDEX_LENGTH, 2);
+            if (end <= data_size) {
+                break;
+            }
+            archive.count--;
+            end = 0;
+        }
+        plat_core_file_unmap(index, index_size);
+        if (index_size != archive.count * ARCHIVE_INDEX_SIZE) {
+            plat_core_file_truncate(ARCHIVE_INDEX_FILE, archive.count * ARCHIVE_INDEX_SIZE);
+        }
+    }
+    if (data_size != end) {
+        plat_core_file_truncate(ARCHIVE_DATA_FILE, end);
+    }
+    archive.data_size = end;
+    menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_ARCHIVE, MENU_STATE_ENABLED);
+}
+
+/*-----------------------------------------------------------------------*/
+void archive_list(void) {
+    // Wait for the last game to be on disk, so it's in the list
+    plat_core_file_flush();
+    archive.first = 0;
+    archive_make_rows();
+    ui_archive_menu.parent_menu = &ui_in_game_menu;
+    menu_set(&ui_archive_menu);
+}
+
+/*-----------------------------------------------------------------------*/
+// Read the game in row of the menu, and show where it ended.  Not while a
+// game is on
+void archive_load(uint8_t row) {
+    const uint8_t *index, *data, *record, *game;
+    uint32_t index_size, data_size, offset;
+    uint16_t length, plies;
+    uint8_t i, piece, sq;
+    position_t *p = &archive.start;
+
+    if (global.state.game_active || row >= ARCHIVE_MENU_ITEMS || archive.first + row >= archive.count) {
+        return;
+    }
+    index = plat_core_file_map(ARCHIVE_INDEX_FILE, &index_size);
+    data = plat_core_file_map(ARCHIVE_DATA_FILE, &data_size);
+    if (!index || !data || (archive.shown[row] + 1) * ARCHIVE_INDEX_SIZE > index_size) {
+        goto done;
+    }
+    record = index + archive.shown[row] * ARCHIVE_INDEX_SIZE;
+    offset = archive_get(record + ARCHIVE_INDEX_OFFSET, 4);
+    length = archive_get(record + ARCHIVE_INDEX_LENGTH, 2);
+    plies = archive_get(record + ARCHIVE_INDEX_PLIES, 2);
+    if (!length || offset + length > data_size) {
+        goto done;
+    }
+    game = data + offset;
+
+    if (*game & ARCHIVE_DATA_SETUP) {
+        memset(p, 0, sizeof(position_t));
+        for (i = 0; i < 64; i++) {
+            sq = MOVEGEN_SQUARE(i >> 3, i & 7);
+            piece = (game[1 + (i >> 1)] >> ((i & 1) << 2)) & 0x0F;
+            p->board[sq] = (piece & 7) | (piece & 8 ? PIECE_WHITE : 0);
+            if ((piece & 7) == KING) {
+                p->king[MOVEGEN_SIDE(p->board[sq])] = sq;
+            }
+        }
+        p->side = game[33];
+        p->castle = game[34];
+        p->ep = game[35];
+        game += 1 + ARCHIVE_SETUP_SIZE;
+    } else {
+        *p = archive_standard;
+        game++;
+    }
+    plies = MIN(plies, MIN(ARCHIVE_PLIES_MAX, data + offset + length - game));
+
+    // Play it through, so the moves are known to be good
+    archive.plies = archive_replay(game, plies);
+    archive.position = archive.review;
+    archive.result = record[ARCHIVE_INDEX_RESULT] & 3;
+    archive.recording = false;
+    archive.game_number[0] = '\0';
+
+    // Show it as a game that is over
+    global.frame.game_number[0] = '\0';
+    strncpy(global.frame.w_name, (const char *)record + ARCHIVE_INDEX_WHITE, ARCHIVE_NAME_LEN);
+    global.frame.w_name[ARCHIVE_NAME_LEN] = '\0';
+    strncpy(global.frame.b_name, (const char *)record + ARCHIVE_INDEX_BLACK, ARCHIVE_NAME_LEN);
+    global.frame.b_name[ARCHIVE_NAME_LEN] = '\0';
+    global.state.includes_me = false;
+    global.state.my_side = record[ARCHIVE_INDEX_PLAYED] & ARCHIVE_PLAYED_BLACK ? SIDE_BLACK : SIDE_WHITE;
+    zobrist_history_clear();
+    zobrist.repeats = 0;
+    for (i = 0; i < 64; i++) {
+        archive_show_square(MOVEGEN_SQUARE(i >> 3, i & 7));
+    }
+    archive_show_flags();
+    archive_panel();
+    global.view.refresh = true;
+
+done:
+    if (index) {
+        plat_core_file_unmap(index, index_size);
+    }
+    if (data) {
+        plat_core_file_unmap(data, data_size);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+void archive_page(bool older) {
+    // A game that ended since the list was made goes in too
+    plat_core_file_flush();
+    if (older && archive.first + ARCHIVE_MENU_ITEMS < archive.count) {
+        archive.first += ARCHIVE_MENU_ITEMS;
+    } else if (!older && archive.first) {
+        archive.first -= MIN(archive.first, ARCHIVE_MENU_ITEMS);
+    }
+    archive_make_rows();
+}
+
+/*-----------------------------------------------------------------------*/
+// Record the move that led to the position style 12 just brought in, or the
+// takeback.  A new game, or a position no move leads to (a move that was
+// missed), starts a new recording
+void archive_position(void) {
+    position_t target;
+    move_t moves[MOVEGEN_MAX_MOVES];
+    undo_t u;
+    uint8_t i, count;
+
+    if (strcmp(archive.game_number, global.frame.game_number)) {
+        archive_start();
+        return;
+    }
+    if (!archive.recording) {
+        return;
+    }
+
+    if (!movegen_set_frame(&target, global.state.chess_board, &global.frame)) {
+        // No move leads there, so leave the recording as it is
+        return;
+    }
+    count = movegen_generate(&archive.position, moves);
+    for (i = 0; i < count; i++) {
+        if (movegen_make(&archive.position, &moves[i], &u)) {
+            if (archive.position.side == target.side && !memcmp(archive.position.board, target.board, MOVEGEN_SQUARES)) {
+                break;
+            }
+            movegen_unmake(&archive.position, &moves[i], &u);
+        }
+    }
+    if (i == count) {
+        if (!archive_take_back(&target)) {
+            archive_start();
+        }
+        return;
+    }
+    if (archive.plies < ARCHIVE_PLIES_MAX) {
+        archive.moves[archive.plies++] = i;
+        archive.review_ready = false;
+    }
+    if (archive.plies == ARCHIVE_OPENING_PLY) {
+        archive.opening = ((uint64_t)zobrist.key.hi << 32) | zobrist.key.lo;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+void archive_shutdown(void) {
+    plat_core_file_flush();
+}
+
+/*-----------------------------------------------------------------------*/
+// A ply on, or back, from what the board shows.  Only the squares the move
+// touched are drawn, so holding the key down runs through the game
+void archive_step(bool forward) {
+    const move_t *m;
+    uint8_t rank;
+
+    if (!archive.plies) {
+        return;
+    }
+    if (!archive.review_ready) {
+        // The board shows where the game got to
+        archive.plies = archive_replay(archive.moves, archive.plies);
+    }
+    if (forward) {
+        if (archive.review_ply == archive.plies) {
+            return;
+        }
+        m = &archive.review_moves[archive.review_ply];
+        movegen_make(&archive.review, m, &archive.review_undo[archive.review_ply]);
+        archive.review_ply++;
+    } else {
+        if (!archive.review_ply) {
+            return;
+        }
+        archive.review_ply--;
+        m = &archive.review_moves[archive.review_ply];
+        movegen_unmake(&archive.review, m, &archive.review_undo[archive.review_ply]);
+    }
+
+    archive_draw_square(m->from);
+    archive_draw_square(m->to);
+    rank = MOVEGEN_RANK(m->from);
+    if (m->flags & MOVEGEN_EN_PASSANT) {
+        archive_draw_square(MOVEGEN_SQUARE(rank, MOVEGEN_FILE(m->to)));
+    } else if (m->flags & MOVEGEN_CASTLE) {
+        // The rook, from the corner to the king's other side
+        archive_draw_square(MOVEGEN_SQUARE(rank, MOVEGEN_FILE(m->to) == 6 ? 7 : 0));
+        archive_draw_square(MOVEGEN_SQUARE(rank, MOVEGEN_FILE(m->to) == 6 ? 5 : 3));
+    }
+    archive_show_flags();
+    archive_panel();
+}
+
+#endif // RETROMATE_ARCHIVE
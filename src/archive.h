@@ -0,0 +1,100 @@
+/*
+ *  archive.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#ifndef _ARCHIVE_H_
+#define _ARCHIVE_H_
+
+#ifdef RETROMATE_ARCHIVE
+
+// Finished games are appended to ARCHIVE_DATA_FILE, and a fixed size record
+// for each to ARCHIVE_INDEX_FILE, so game n is 2 seeks away
+#define ARCHIVE_DATA_FILE       "archive.dat"
+#define ARCHIVE_INDEX_FILE      "archive.idx"
+#define ARCHIVE_PLIES_MAX       1024        // A longer game keeps its first plies
+#define ARCHIVE_OPENING_PLY     16          // The opening key is the position after this
+#define ARCHIVE_NAME_LEN        18
+#define ARCHIVE_MENU_ITEMS      10
+#define ARCHIVE_SHOWN_NAME_LEN  10
+// "251018 WFMKierzek FMKarl     1-0"
+#define ARCHIVE_ROW_LEN         (6 + 1 + ARCHIVE_SHOWN_NAME_LEN + 1 + ARCHIVE_SHOWN_NAME_LEN + 1 + 3)
+
+// A game in ARCHIVE_DATA_FILE is a flags byte, then the start position if it
+// isn't the usual one, then a byte a ply - the move's place in the list
+// movegen_generate makes
+#define ARCHIVE_DATA_SETUP      0x01
+#define ARCHIVE_SETUP_SIZE      35          // 2 squares a byte, side, castle, ep
+
+// A game in ARCHIVE_INDEX_FILE, little endian
+enum {
+    ARCHIVE_INDEX_OFFSET    = 0,    // uint32, into ARCHIVE_DATA_FILE
+    ARCHIVE_INDEX_LENGTH    = 4,    // uint16
+    ARCHIVE_INDEX_PLIES     = 6,    // uint16
+    ARCHIVE_INDEX_DATE      = 8,    // uint32, seconds since 1970
+    ARCHIVE_INDEX_RESULT    = 12,   // ARCHIVE_RESULT_*
+    ARCHIVE_INDEX_PLAYED    = 13,   // ARCHIVE_PLAYED_*
+    ARCHIVE_INDEX_WHITE     = 14,   // char[ARCHIVE_NAME_LEN], '\0' padded
+    ARCHIVE_INDEX_BLACK     = 32,
+    ARCHIVE_INDEX_TIME      = 50,   // Minutes
+    ARCHIVE_INDEX_INCREMENT = 51,   // Seconds
+    ARCHIVE_INDEX_OPENING   = 56,   // uint64, zobrist.key ARCHIVE_OPENING_PLY in
+    ARCHIVE_INDEX_SIZE      = 64,
+};
+
+enum {
+    ARCHIVE_RESULT_NONE,
+    ARCHIVE_RESULT_WHITE,
+    ARCHIVE_RESULT_BLACK,
+    ARCHIVE_RESULT_DRAW,
+};
+
+// ARCHIVE_INDEX_PLAYED
+#define ARCHIVE_PLAYED_WHITE    0x01
+#define ARCHIVE_PLAYED_BLACK    0x02
+
+typedef struct _archive {
+    // The game being recorded, or the one loaded
+    char game_number[7];
+    bool recording;
+    uint8_t played;                 // ARCHIVE_PLAYED_*
+    uint8_t result;                 // ARCHIVE_RESULT_*
+    uint64_t opening;
+    position_t start;
+    position_t position;            // After the last ply
+    uint16_t plies;
+    uint8_t moves[ARCHIVE_PLIES_MAX];
+    // Stepping through it.  The moves are made once, so a step back is an
+    // unmake, with no move list to generate
+    bool review_ready;
+    uint16_t review_ply;            // Plies into the game the board shows
+    position_t review;
+    move_t review_moves[ARCHIVE_PLIES_MAX];
+    undo_t review_undo[ARCHIVE_PLIES_MAX];
+    // The files, as they will be once the appends are done
+    uint32_t count;                 // Games
+    uint32_t data_size;
+    // The menu, newest first
+    uint32_t first;                 // Game in the top row
+    uint32_t shown[ARCHIVE_MENU_ITEMS];
+    char rows[ARCHIVE_MENU_ITEMS][ARCHIVE_ROW_LEN + 1];
+} archive_t;
+
+extern archive_t archive;
+
+void archive_game_over(const char *text, int len);
+void archive_init(void);
+void archive_list(void);
+void archive_load(uint8_t row);
+void archive_page(bool older);
+void archive_position(void);
+void archive_shutdown(void);
+void archive_step(bool forward);
+
+#endif // RETROMATE_ARCHIVE
+
+#endif // _ARCHIVE_H_
@@ -1,316 +0,0 @@
-/*
- *  dataAtari.c
- *  cc65 Chess
- *
- *  Created by Stefan Wessels, July 2020.
- *
- */
-
-#include "../global.h"
-
-#include "platAtari.h"
-
-/*-----------------------------------------------------------------------*/
-// Atari specific graphics for the chess pieces
-char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
-    {
-        {
-            0x00, 0x00, 0x00,
-            0x3C, 0x7C, 0x78,
-            0x24, 0x44, 0x48,
-            0x24, 0x44, 0x48,
-            0x27, 0xC7, 0xC8,
-            0x20, 0x00, 0x08,
-            0x10, 0x00, 0x10,
-            0x08, 0x00, 0x20,
-            0x05, 0xFF, 0x40,
-            0x06, 0x00, 0xC0,
-            0x02, 0x00, 0x80,
-            0x02, 0x00, 0x80,
-            0x02, 0x00, 0x80,
-            0x02, 0x00, 0x80,
-            0x02, 0x00, 0x80,
-            0x04, 0x00, 0x40,
-            0x08, 0x00, 0x20,
-            0x0B, 0xFF, 0xA0,
-            0x10, 0x00, 0x10,
-            0x3F, 0xFF, 0xF8,
-            0x3F, 0xFF, 0xF8,
-            0x00, 0x00, 0x00,
-        },
-        {
-            0x00, 0x00, 0x00,
-            0x3C, 0x7C, 0x78,
-            0x3C, 0x7C, 0x78,
-            0x3C, 0x7C, 0x78,
-            0x3F, 0xFF, 0xF8,
-            0x3F, 0xFF, 0xF8,
-            0x1F, 0xFF, 0xF0,
-            0x0F, 0xFF, 0xE0,
-            0x07, 0xFF, 0xC0,
-            0x04, 0x00, 0x40,
-            0x03, 0xFF, 0x80,
-            0x03, 0xFF, 0x80,
-            0x03, 0xFF, 0x80,
-            0x03, 0xFF, 0x80,
-            0x03, 0xFF, 0x80,
-            0x07, 0xFF, 0xC0,
-            0x0F, 0xFF, 0xE0,
-            0x0F, 0xFF, 0xE0,
-            0x10, 0x00, 0x10,
-            0x3F, 0xFF, 0xF8,
-            0x3F, 0xFF, 0xF8,
-            0x00, 0x00, 0x00,
-        },
-    },
-    {
-        {
-            0x00, 0x00, 0x00,
-            0x00, 0x88, 0x00,
-            0x01, 0x54, 0x00,
-            0x02, 0x12, 0x00,
-            0x02, 0x01, 0x00,
-            0x04, 0x00, 0x80,
-            0x04, 0x42, 0x80,
-            0x04, 0x02, 0x80,
-            0x08, 0x03, 0x40,
-            0x10, 0x01, 0x40,
-            0x20, 0x00, 0x40,
-            0x21, 0xE0, 0x40,
-            0x12, 0x11, 0x60,
-            0x0C, 0x21, 0xA0,
-            0x00, 0x40, 0x90,
-            0x00, 0x80, 0x50,
-            0x01, 0x00, 0x18,
-            0x02, 0x00, 0x08,
-            0x05, 0xFF, 0xE8,
-            0x04, 0x00, 0x08,
-            0x07, 0xFF, 0xF8,
-            0x00, 0x00, 0x00,
-        },
-        {
-            0x00, 0x00, 0x00,
-            0x00, 0x88, 0x00,
-            0x01, 0x54, 0x00,
-            0x03, 0xEE, 0x00,
-            0x03, 0xFF, 0x00,
-            0x07, 0xFF, 0x80,
-            0x07, 0xBD, 0x80,
-            0x07, 0xFD, 0x80,
-            0x0F, 0xFC, 0xC0,
-            0x1F, 0xFE, 0xC0,
-            0x3F, 0xFF, 0xC0,
-            0x3F, 0xFF, 0xC0,
-            0x1E, 0x1E, 0xE0,
-            0x0C, 0x3E, 0x60,
-            0x00, 0x7F, 0x70,
-            0x00, 0xFF, 0xB0,
-            0x01, 0xFF, 0xF8,
-            0x03, 0xFF, 0xF8,
-            0x04, 0x00, 0x08,
-            0x07, 0xFF, 0xF8,
-            0x07, 0xFF, 0xF8,
-            0x00, 0x00, 0x00,
-        },
-    },
-    {
-        {
-            0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00,
-            0x00, 0x38, 0x00,
-            0x00, 0x44, 0x00,
-            0x00, 0x82, 0x00,
-            0x01, 0x11, 0x00,
-            0x02, 0x10, 0x80,
-            0x02, 0xFE, 0x80,
-            0x04, 0x10, 0x40,
-            0x04, 0x10, 0x40,
-            0x04, 0x10, 0x40,
-            0x02, 0x10, 0x80,
-            0x02, 0x00, 0x80,
-            0x01, 0x01, 0x00,
-            0x00, 0xFE, 0x00,
-            0x00, 0x82, 0x00,
-            0x00, 0x82, 0x00,
-            0x00, 0x7C, 0x00,
-            0x02, 0x00, 0x80,
-            0x0F, 0xFF, 0xE0,
-            0x1F, 0xFF, 0xF0,
-            0x00, 0x00, 0x00,
-        },
-        {
-            0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00,
-            0x00, 0x38, 0x00,
-            0x00, 0x7C, 0x00,
-            0x00, 0xFE, 0x00,
-            0x01, 0xEF, 0x00,
-            0x03, 0xEF, 0x80,
-            0x03, 0x01, 0x80,
-            0x07, 0xEF, 0xC0,
-            0x07, 0xEF, 0xC0,
-            0x07, 0xEF, 0xC0,
-            0x03, 0xEF, 0x80,
-            0x03, 0xFF, 0x80,
-            0x01, 0xFF, 0x00,
-            0x00, 0x82, 0x00,
-            0x00, 0xFE, 0x00,
-            0x00, 0xFE, 0x00,
-            0x00, 0x7C, 0x00,
-            0x03, 0xFF, 0x80,
-            0x08, 0x00, 0x20,
-            0x1F, 0xFF, 0xF0,
-            0x00, 0x00, 0x00,
-        },
-    },
-    {
-        {
-            0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00,
-            0x00, 0x38, 0x00,
-            0x00, 0x44, 0x00,
-            0x0E, 0x44, 0xE0,
-            0x11, 0x29, 0x10,
-            0x21, 0x45, 0x08,
-            0x22, 0x82, 0x88,
-            0x20, 0x00, 0x08,
-            0x22, 0x10, 0x88,
-            0x23, 0x39, 0x88,
-            0x11, 0xFF, 0x10,
-            0x10, 0xFE, 0x10,
-            0x08, 0x00, 0x20,
-            0x08, 0x00, 0x20,
-            0x0B, 0xFF, 0xA0,
-            0x04, 0x00, 0x40,
-            0x04, 0x00, 0x40,
-            0x04, 0x00, 0x40,
-            0x06, 0x00, 0xC0,
-            0x03, 0xFF, 0x80,
-            0x00, 0x00, 0x00,
-        },
-        {
-            0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00,
-            0x00, 0x38, 0x00,
-            0x00, 0x7C, 0x00,
-            0x0E, 0x7C, 0xE0,
-            0x1F, 0x39, 0xF0,
-            0x3F, 0x7D, 0xF8,
-            0x3E, 0xFE, 0xF8,
-            0x3F, 0xFF, 0xF8,
-            0x3D, 0xEF, 0x78,
-            0x3C, 0xC6, 0x78,
-            0x1E, 0x00, 0xF0,
-            0x1F, 0x01, 0xF0,
-            0x0F, 0xFF, 0xE0,
-            0x0F, 0xFF, 0xE0,
-            0x0C, 0x00, 0x60,
-            0x07, 0xFF, 0xC0,
-            0x07, 0xFF, 0xC0,
-            0x07, 0xFF, 0xC0,
-            0x07, 0xFF, 0xC0,
-            0x03, 0xFF, 0x80,
-            0x00, 0x00, 0x00,
-        },
-    },
-    {
-        {
-            0x00, 0x00, 0x00,
-            0x00, 0x38, 0x00,
-            0x00, 0x28, 0x00,
-            0x00, 0xEE, 0x00,
-            0x00, 0xC6, 0x00,
-            0x03, 0x29, 0x80,
-            0x04, 0xAA, 0x40,
-            0x08, 0x6C, 0x20,
-            0x10, 0x28, 0x10,
-            0x12, 0x44, 0x90,
-            0x24, 0x28, 0x48,
-            0x24, 0x10, 0x48,
-            0x22, 0x10, 0x88,
-            0x11, 0x01, 0x10,
-            0x10, 0x82, 0x10,
-            0x08, 0x00, 0x20,
-            0x09, 0xFF, 0x20,
-            0x04, 0x00, 0x40,
-            0x04, 0x00, 0x40,
-            0x06, 0x00, 0xC0,
-            0x03, 0xFF, 0x80,
-            0x00, 0x00, 0x00,
-        },
-        {
-            0x00, 0x00, 0x00,
-            0x00, 0x38, 0x00,
-            0x00, 0x28, 0x00,
-            0x00, 0xEE, 0x00,
-            0x00, 0xC6, 0x00,
-            0x03, 0x29, 0x80,
-            0x07, 0xAB, 0xC0,
-            0x0F, 0xEF, 0xE0,
-            0x1F, 0xC7, 0xF0,
-            0x1D, 0xAB, 0x70,
-            0x3B, 0xC7, 0xB8,
-            0x3B, 0xEF, 0xB8,
-            0x3D, 0xFF, 0x78,
-            0x1E, 0xFE, 0xF0,
-            0x1F, 0x7D, 0xF0,
-            0x0F, 0xFF, 0xE0,
-            0x0C, 0x00, 0x60,
-            0x07, 0xFF, 0xC0,
-            0x07, 0xFF, 0xC0,
-            0x07, 0xFF, 0xC0,
-            0x03, 0xFF, 0x80,
-            0x00, 0x00, 0x00,
-        },
-    },
-    {
-        {
-            0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00,
-            0x00, 0x38, 0x00,
-            0x00, 0x44, 0x00,
-            0x00, 0x82, 0x00,
-            0x00, 0x82, 0x00,
-            0x00, 0x82, 0x00,
-            0x00, 0x44, 0x00,
-            0x00, 0x38, 0x00,
-            0x00, 0x44, 0x00,
-            0x00, 0x44, 0x00,
-            0x00, 0xC6, 0x00,
-            0x00, 0x44, 0x00,
-            0x00, 0x44, 0x00,
-            0x00, 0xFE, 0x00,
-            0x01, 0x01, 0x00,
-            0x03, 0xFF, 0x80,
-            0x03, 0xFF, 0x80,
-            0x00, 0x00, 0x00,
-        },
-        {
-            0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00,
-            0x00, 0x38, 0x00,
-            0x00, 0x7C, 0x00,
-            0x00, 0xFE, 0x00,
-            0x00, 0xFE, 0x00,
-            0x00, 0xFE, 0x00,
-            0x00, 0x7C, 0x00,
-            0x00, 0x38, 0x00,
-            0x00, 0x7C, 0x00,
-            0x00, 0x7C, 0x00,
-            0x00, 0xFE, 0x00,
-            0x00, 0x7C, 0x00,
-            0x00, 0x7C, 0x00,
-            0x00, 0xFE, 0x00,
-            0x01, 0x01, 0x00,
-            0x03, 0xFF, 0x80,
-            0x03, 0xFF, 0x80,
-            0x00, 0x00, 0x00,
-        },
-    },
-};
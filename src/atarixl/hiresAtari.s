@@ -11,7 +11,7 @@
 .include "atari.inc"
 .include "zeropage.inc"
 
-.export _hires_init, _hires_done, _hires_draw, _hires_mask
+.export _hires_init, _hires_done, _hires_draw, _hires_mask, _text_rows
 .import popa, popax, _hires_piece
 
 
@@ -42,11 +42,16 @@ hires_list:
         .endrep
         .byte $41,<hires_list,>hires_list        ; Vertical Blank jump to start of hires_list
 
+;-----------------------------------------------------------------------
+; Display list - text mode 2.  Its own segment too, as after hires_list it
+; could cross a 1K boundry
+.segment "TLIST"
+
 text_list:
         .byte $70,$70,$70                        ; 24 blank lines
-        .byte $40 + txt_mode,<txt_scrn,>txt_scrn ; Mode $0x + LMS, setting screen memory to $9100
-        .repeat 24                               ; 96 lines of mode $0x (incl LMS row above)
-            .byte txt_mode
+_text_rows:                                      ; Every row has an LMS, that plat_draw_log points
+        .repeat 24, I                            ; at the terminal log.  Row I's is at _text_rows+I*3+1
+            .byte $40 + txt_mode, <(txt_scrn + I * 40), >(txt_scrn + I * 40)
         .endrep
         .byte $41,<text_list,>text_list          ; Vertical Blank jump to start of text_list
 
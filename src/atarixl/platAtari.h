@@ -24,6 +24,9 @@
 #define SQUARE_DISPLAY_HEIGHT   22
 #define BOARD_DISPLAY_HEIGHT    (SQUARE_DISPLAY_HEIGHT * 8)
 
+// The settings, on drive 1
+#define CONFIG_FILE_NAME        "D:RMATE.CFG"
+
 #define ROP_CONST(val)          0xA900|(val)
 #define ROP_BLACK               0xA900
 #define ROP_WHITE               0xA9FF
@@ -32,6 +35,14 @@
 #define ROP_INV                 0x49FF
 #define ROP_AND(val)            0x2900|(val)
 
+// The terminal.  The text screen is the last row of the display list and the
+// bounce for rows that can't be shown where they are.  The font is in ASCII
+// order, so the log shows as is, and uses hires memory the text doesn't
+#define TXT_SCRN                ((char *)0xBC00)
+#define TERM_FONT               ((char *)0xB800)
+#define ANTIC_4K_MASK           0x0FFF          // ANTIC can't fetch across 4K
+extern char text_rows[];                        // LMS of row i at [i * 3 + 1]
+
 void hires_init(void);
 void hires_done(void);
 void hires_draw(char xpos,    char ypos,
@@ -41,6 +52,17 @@ void hires_mask(char xpos,    char ypos,
                 char xsize,   char ysize,
                 unsigned rop);
 
+// 130XE banks (see xmemAtari.s).  xmem_get and xmem_put copy xmem_row from
+// and to xmem_window in bank xmem_bank
+#define XMEM_WINDOW             0x4000
+#define XMEM_BANK_ROWS          (0x4000 / LOG_HISTORY_COLS)
+extern char xmem_row[LOG_HISTORY_COLS];
+extern uint8_t xmem_bank;
+extern char *xmem_window;
+uint8_t xmem_detect(void);
+void xmem_get(void);
+void xmem_put(void);
+
 /*-----------------------------------------------------------------------*/
 typedef struct _atari {
     char rop_line[2][8];
@@ -57,5 +79,8 @@ typedef struct _atari {
 
 extern atari_t atari;
 extern char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT];
+// Made by cmake/GenCharmaps.cmake
+extern const uint8_t charmap_ascii_to_internal[256];
+extern const uint8_t charmap_atascii_to_ascii[256];
 
 #endif //_PLATATARI_H_
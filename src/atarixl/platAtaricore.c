@@ -9,8 +9,10 @@
 
 #include <atari.h>
 #include <conio.h>  // kbhit, cgetc
+#include <fcntl.h>  // open
 #include <stdlib.h> // exit
 #include <string.h> // memcpy
+#include <unistd.h> // read, write, close
 
 #include "../global.h"
 
@@ -18,21 +20,93 @@
 
 #pragma code-name(push, "SHADOW_RAM2")
 
+/*-----------------------------------------------------------------------*/
+// Copy the font in ASCII order, so the terminal shows the log's text as is
+static void plat_core_term_font(void) {
+    uint8_t c;
+    char *dst = TERM_FONT;
+
+    for (c = 0; c < 128; c++) {
+        memcpy(dst, atari.CHAR_ROM + charmap_ascii_to_internal[c] * 8, 8);
+        dst += 8;
+    }
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_core_active_term(bool active) {
     if (active) {
         hires_done();
-        clrscr();
+        plat_core_term_font();
+        memset(TXT_SCRN, ' ', SCREEN_TEXT_WIDTH * SCREEN_TEXT_HEIGHT);
+        OS.chbas = (unsigned)TERM_FONT >> 8;
         global.view.terminal_active = 1;
     } else {
-        clrscr();
+        OS.chbas = (unsigned)atari.CHAR_ROM >> 8;
         hires_init();
+        // The text screen and font were in the hires screen
+        plat_draw_clrscr();
         plat_draw_board();
         global.view.terminal_active = 0;
         plat_draw_log(&global.view.info_panel, plat_core_get_status_x(), 0, true);
     }
 }
 
+#ifdef RETROMATE_BENCH
+// There's no free running cycle timer, so frames (RTCLOK) and the line in the
+// frame (VCOUNT, in pairs of lines of 114 cycles) make one
+#define BENCH_VBI_VCOUNT        124     // RTCLOK ticks in the VBI, at line 248
+#define BENCH_CYCLES_PER_VCOUNT 228
+
+static uint32_t bench_start;
+
+/*-----------------------------------------------------------------------*/
+static uint32_t plat_core_bench_now(void) {
+    uint8_t lo, hi, line, vcounts;
+    vcounts = get_tv() == AT_PAL ? 156 : 131;
+    do {
+        lo = OS.rtclok[2];
+        hi = OS.rtclok[1];
+        line = ANTIC.vcount;
+    } while (lo != OS.rtclok[2]);
+    // Lines from the VBI that ticked RTCLOK
+    line = line >= BENCH_VBI_VCOUNT ? line - BENCH_VBI_VCOUNT : line + vcounts - BENCH_VBI_VCOUNT;
+    return ((uint32_t)((uint16_t)hi << 8 | lo) * vcounts + line) * BENCH_CYCLES_PER_VCOUNT;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_bench_start(void) {
+    bench_start = plat_core_bench_now();
+}
+
+/*-----------------------------------------------------------------------*/
+uint32_t plat_core_bench_cycles(void) {
+    return plat_core_bench_now() - bench_start;
+}
+#endif
+
+/*-----------------------------------------------------------------------*/
+bool plat_core_config_load(void *data, uint8_t size) {
+    int fd = open(CONFIG_FILE_NAME, O_RDONLY);
+    bool loaded;
+
+    if (fd < 0) {
+        return false;
+    }
+    loaded = read(fd, data, size) == size;
+    close(fd);
+    return loaded;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_config_save(const void *data, uint8_t size) {
+    int fd = open(CONFIG_FILE_NAME, O_WRONLY | O_CREAT | O_TRUNC);
+
+    if (fd >= 0) {
+        write(fd, data, size);
+        close(fd);
+    }
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_core_copy_ascii_to_display(void *dest, const void *src, size_t n) {
     memcpy(dest, src, n);
@@ -59,6 +133,35 @@ uint8_t plat_core_get_status_x(void) {
     return 3 + SQUARE_TEXT_WIDTH * 8;
 }
 
+/*-----------------------------------------------------------------------*/
+// Bank and window address of a history slot.  Rows don't straddle banks
+static void plat_core_history_slot(uint16_t slot) {
+    xmem_bank = slot / XMEM_BANK_ROWS;
+    xmem_window = (char *)XMEM_WINDOW + (slot % XMEM_BANK_ROWS) * LOG_HISTORY_COLS;
+}
+
+/*-----------------------------------------------------------------------*/
+const char *plat_core_history_get(uint16_t slot) {
+    plat_core_history_slot(slot);
+    xmem_get();
+    return xmem_row;
+}
+
+/*-----------------------------------------------------------------------*/
+// The terminal history lives in the 4 extended banks of a 130XE (or an XL
+// with a compatible upgrade).  Without, there's just the screen of log
+uint16_t plat_core_history_init(void) {
+    return xmem_detect() * XMEM_BANK_ROWS;
+}
+
+/*-----------------------------------------------------------------------*/
+// The log may be under the bank window, so the row goes through xmem_row
+void plat_core_history_put(uint16_t slot, const char *row) {
+    memcpy(xmem_row, row, LOG_HISTORY_COLS);
+    plat_core_history_slot(slot);
+    xmem_put();
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_core_init() {
     uint8_t i;
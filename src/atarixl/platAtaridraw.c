@@ -7,7 +7,6 @@
  *
  */
 
-#include <conio.h>
 #include <string.h>
 
 #include "../global.h"
@@ -87,10 +86,7 @@ atari_t atari = {
 /*-----------------------------------------------------------------------*/
 // x in Character coords, y in Graphics coords
 static void plat_draw_char(char x, char y, unsigned rop, char c) {
-    if (c < 'a' || c > 'z') {
-        c -= 32;
-    }
-    hires_draw(x, y, 1, 8, rop, atari.CHAR_ROM + c * 8);
+    hires_draw(x, y, 1, 8, rop, atari.CHAR_ROM + charmap_ascii_to_internal[(uint8_t)c] * 8);
 }
 
 /*-----------------------------------------------------------------------*/
@@ -176,7 +172,7 @@ void plat_draw_board() {
 /*-----------------------------------------------------------------------*/
 void plat_draw_clear_input_line(bool) {
     if (global.view.terminal_active) {
-        cclearxy(0, SCREEN_TEXT_HEIGHT - 1, atari.terminal_display_width);
+        memset(TXT_SCRN + (SCREEN_TEXT_HEIGHT - 1) * SCREEN_TEXT_WIDTH, ' ', atari.terminal_display_width);
     } else {
         hires_mask(0, (SCREEN_TEXT_HEIGHT - 1) * CHARACTER_HEIGHT, SCREEN_TEXT_WIDTH, CHARACTER_HEIGHT, ROP_BLACK);
     }
@@ -184,6 +180,10 @@ void plat_draw_clear_input_line(bool) {
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_clear_statslog_area(uint8_t row) {
+    // The terminal's font is in the hires screen, which is cleared on the way back
+    if (global.view.terminal_active) {
+        return;
+    }
     hires_mask(plat_core_get_status_x(), CHARACTER_HEIGHT * row,
                global.view.info_panel.cols, CHARACTER_HEIGHT * (SCREEN_TEXT_HEIGHT - row),
                ROP_BLACK);
@@ -212,16 +212,41 @@ void plat_draw_highlight(uint8_t position, uint8_t color) {
 
 #pragma code-name(push, "SHADOW_RAM")
 
+/*-----------------------------------------------------------------------*/
+// Point the display list's rows at the log, so a new line is a few LMS bytes
+// and not a screen of text.  The pan is an offset into the row.  A row that
+// isn't in the log buffer (it came from the history), or that would cross a
+// 4K boundary, is copied to its row of the text screen and shown from there
+static void plat_draw_terminal(tLog *log, uint8_t pan) {
+    uint8_t i;
+    const char *row;
+    char *line = TXT_SCRN;
+    char *lms = text_rows + 1;
+    const char *log_end = log->buffer + log->buffer_size;
+
+    for (i = 0; i < log->rows; i++) {
+        row = line;
+        if (i < log->size) {
+            row = log_row(log, i) + pan;
+            if (row < log->buffer || row >= log_end ||
+                    ((unsigned)row & ANTIC_4K_MASK) > ANTIC_4K_MASK + 1 - SCREEN_TEXT_WIDTH) {
+                memcpy(line, row, SCREEN_TEXT_WIDTH);
+                row = line;
+            }
+        }
+        lms[0] = (unsigned)row & 0xFF;
+        lms[1] = (unsigned)row >> 8;
+        lms += 3;
+        line += SCREEN_TEXT_WIDTH;
+    }
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool) {
-    int i;
-    char *log_end = log->buffer + log->buffer_size;
-    char *log_render = log->buffer;
+    uint8_t i;
+    uint8_t pan = 0;
     uint8_t width = log->cols;
 
-    if (log->size >= log->rows) {
-        log_render += log->cols * log->head;
-    }
     log->modified = false;
 
     if (width > atari.terminal_display_width) {
@@ -231,15 +256,16 @@ void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool) {
             global.view.pan_value = 0;
         }
         width = SCREEN_TEXT_WIDTH;
-        log_render += 20 * shift;
+        pan = 20 * shift;
+    }
+
+    if (log == &global.view.terminal && global.view.terminal_active) {
+        plat_draw_terminal(log, pan);
+        return;
     }
 
     for (i = 0; i < log->size; ++i) {
-        plat_draw_text(x, y++, log_render, width);
-        log_render += log->cols;
-        if (log_render >= log_end) {
-            log_render = log->buffer + (log_render - log_end);
-        }
+        plat_draw_text(x, y++, log_row(log, i) + pan, width);
     }
 }
 
@@ -311,10 +337,8 @@ void plat_draw_square(uint8_t position) {
 /*-----------------------------------------------------------------------*/
 void plat_draw_text(uint8_t x, uint8_t y, const char *text, uint8_t len) {
     if (global.view.terminal_active) {
-        gotoxy(x, y);
-        while (len--) {
-            cputc(*text++);
-        }
+        // The terminal font is in ASCII order
+        memcpy(TXT_SCRN + y * SCREEN_TEXT_WIDTH + x, text, len);
     } else {
         y *= CHARACTER_HEIGHT;
         while (len) {
@@ -21,12 +21,7 @@
 static int plat_net_make_ascii(const char *text) {
     char i = 0;
     while (*text) {
-        char c = *text++;
-        if (c == 0x9b) {
-            atari.send_buffer[i++] = 0x0a;
-        } else {
-            atari.send_buffer[i++] = c;
-        }
+        atari.send_buffer[i++] = charmap_atascii_to_ascii[(uint8_t)*text++];
     }
     // This seems like a good idea but it locks the Atari up.
     // atari.send_buffer[i++] = '\x0a';
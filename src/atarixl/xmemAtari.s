@@ -0,0 +1,165 @@
+;
+; xmemAtari.s
+; RetroMate
+;
+; Created by Stefan Wessels, 2025.
+;
+;
+
+;-----------------------------------------------------------------------
+; 130XE extended memory.  PORTB bits 2-3 pick one of 4 16K banks, and bit 4
+; clear puts it at $4000-$7FFF for the CPU.  Bit 5 stays set so ANTIC keeps
+; seeing main RAM.  The program has code and data under that window, so this
+; runs from LOWCODE, only copies through xmem_row in LOWBSS, and keeps IRQs
+; off while a bank is in
+.include "atari.inc"
+.include "zeropage.inc"
+
+.export _xmem_detect, _xmem_get, _xmem_put
+.export _xmem_row, _xmem_bank, _xmem_window
+
+window   = $4000
+row_len  = 80
+banks    = 4
+
+;-----------------------------------------------------------------------
+.segment "LOWBSS"
+
+_xmem_row:      .res row_len
+_xmem_bank:     .res 1                           ; 0..3
+_xmem_window:   .res 2                           ; Address in $4000-$7FFF
+portb_save:     .res 1
+flags_save:     .res 1
+main_save:      .res 1
+
+;-----------------------------------------------------------------------
+.segment "LOWCODE"
+
+;-----------------------------------------------------------------------
+; Returns banks (4) on a 130XE.  On a 64K machine the tags all land in main
+; RAM, so they don't read back
+.proc _xmem_detect
+
+        php
+        sei
+        lda PORTB
+        sta portb_save
+        lda window                               ; main RAM under the window
+        sta main_save
+
+        ldx #banks-1                             ; tag each bank with its number
+tag:
+        txa
+        jsr bank_portb
+        sta PORTB
+        stx window
+        dex
+        bpl tag
+
+        lda portb_save
+        sta PORTB
+        lda #$FF                                 ; and main RAM with none
+        sta window
+
+        ldx #banks-1
+check:
+        txa
+        jsr bank_portb
+        sta PORTB
+        cpx window
+        bne none
+        dex
+        bpl check
+        lda #banks
+        bne done
+
+none:
+        lda #0
+done:
+        ldx portb_save
+        stx PORTB
+        ldx main_save
+        stx window
+        plp
+        ldx #0
+        rts
+
+.endproc
+
+;-----------------------------------------------------------------------
+; Copy the row at xmem_window in xmem_bank to xmem_row
+.proc _xmem_get
+
+        jsr bank_in
+        ldy #row_len-1
+loop:
+        lda (ptr1),y
+        sta _xmem_row,y
+        dey
+        bpl loop
+        jmp bank_out
+
+.endproc
+
+;-----------------------------------------------------------------------
+; Copy xmem_row to xmem_window in xmem_bank
+.proc _xmem_put
+
+        jsr bank_in
+        ldy #row_len-1
+loop:
+        lda _xmem_row,y
+        sta (ptr1),y
+        dey
+        bpl loop
+        jmp bank_out
+
+.endproc
+
+;-----------------------------------------------------------------------
+; Point ptr1 at the window and switch xmem_bank in, IRQs off
+.proc bank_in
+
+        lda _xmem_window
+        sta ptr1
+        lda _xmem_window+1
+        sta ptr1+1
+        php
+        pla
+        sta flags_save
+        sei
+        lda PORTB
+        sta portb_save
+        lda _xmem_bank
+        jsr bank_portb
+        sta PORTB
+        rts
+
+.endproc
+
+;-----------------------------------------------------------------------
+; Main RAM back in, and the IRQ flag as it was
+.proc bank_out
+
+        lda portb_save
+        sta PORTB
+        lda flags_save
+        pha
+        plp
+        rts
+
+.endproc
+
+;-----------------------------------------------------------------------
+; PORTB with bank A for the CPU, from portb_save.  X is kept
+.proc bank_portb
+
+        asl
+        asl
+        sta tmp1
+        lda portb_save
+        and #%11100011
+        ora tmp1
+        rts
+
+.endproc
@@ -0,0 +1,162 @@
+/*
+ *  bench.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "global.h"
+
+// Only in the _bench builds.  Times the drawing, the style 12 parsing and the
+// games list parsing, in cycles, with the platform's timer (see
+// plat_core_bench_start)
+
+#define BENCH_STYLE12_LINES         100
+#define BENCH_GAMES_ROWS            100
+
+// Captured from an observed game (so parsing them sends nothing).  Server
+// data, so ASCII encoded as hex (see fics.c)
+static const char *bench_style12[] = {
+    // "<12> rnbqkbnr pppppppp -------- -------- ----P--- -------- PPPP-PPP RNBQKBNR B 4 1 1 1 1 0 7 Kasparov Karpov 0 5 0 39 39 300 300 1 P/e2-e4 (0:00) e4 0 1 0"
+    "\x3c\x31\x32\x3e\x20\x72\x6e\x62\x71\x6b\x62\x6e\x72\x20\x70\x70"
+    "\x70\x70\x70\x70\x70\x70\x20\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x20"
+    "\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x20\x2d\x2d\x2d\x2d\x50\x2d\x2d"
+    "\x2d\x20\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x20\x50\x50\x50\x50\x2d"
+    "\x50\x50\x50\x20\x52\x4e\x42\x51\x4b\x42\x4e\x52\x20\x42\x20\x34"
+    "\x20\x31\x20\x31\x20\x31\x20\x31\x20\x30\x20\x37\x20\x4b\x61\x73"
+    "\x70\x61\x72\x6f\x76\x20\x4b\x61\x72\x70\x6f\x76\x20\x30\x20\x35"
+    "\x20\x30\x20\x33\x39\x20\x33\x39\x20\x33\x30\x30\x20\x33\x30\x30"
+    "\x20\x31\x20\x50\x2f\x65\x32\x2d\x65\x34\x20\x28\x30\x3a\x30\x30"
+    "\x29\x20\x65\x34\x20\x30\x20\x31\x20\x30\x0a",
+    // "<12> rnbqkbnr pppp-ppp -------- ----p--- ----P--- -------- PPPP-PPP RNBQKBNR W 4 1 1 1 1 0 7 Kasparov Karpov 0 5 0 39 39 300 298 2 P/e7-e5 (0:02) e5 0 1 0"
+    "\x3c\x31\x32\x3e\x20\x72\x6e\x62\x71\x6b\x62\x6e\x72\x20\x70\x70"
+    "\x70\x70\x2d\x70\x70\x70\x20\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x20"
+    "\x2d\x2d\x2d\x2d\x70\x2d\x2d\x2d\x20\x2d\x2d\x2d\x2d\x50\x2d\x2d"
+    "\x2d\x20\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x20\x50\x50\x50\x50\x2d"
+    "\x50\x50\x50\x20\x52\x4e\x42\x51\x4b\x42\x4e\x52\x20\x57\x20\x34"
+    "\x20\x31\x20\x31\x20\x31\x20\x31\x20\x30\x20\x37\x20\x4b\x61\x73"
+    "\x70\x61\x72\x6f\x76\x20\x4b\x61\x72\x70\x6f\x76\x20\x30\x20\x35"
+    "\x20\x30\x20\x33\x39\x20\x33\x39\x20\x33\x30\x30\x20\x32\x39\x38"
+    "\x20\x32\x20\x50\x2f\x65\x37\x2d\x65\x35\x20\x28\x30\x3a\x30\x32"
+    "\x29\x20\x65\x35\x20\x30\x20\x31\x20\x30\x0a",
+    // "<12> rnbqkbnr pppp-ppp -------- ----p--- ----P--- -----N-- PPPP-PPP RNBQKB-R B -1 1 1 1 1 1 7 Kasparov Karpov 0 5 0 39 39 297 298 2 N/g1-f3 (0:03) Nf3 0 1 0"
+    "\x3c\x31\x32\x3e\x20\x72\x6e\x62\x71\x6b\x62\x6e\x72\x20\x70\x70"
+    "\x70\x70\x2d\x70\x70\x70\x20\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x2d\x20"
+    "\x2d\x2d\x2d\x2d\x70\x2d\x2d\x2d\x20\x2d\x2d\x2d\x2d\x50\x2d\x2d"
+    "\x2d\x20\x2d\x2d\x2d\x2d\x2d\x4e\x2d\x2d\x20\x50\x50\x50\x50\x2d"
+    "\x50\x50\x50\x20\x52\x4e\x42\x51\x4b\x42\x2d\x52\x20\x42\x20\x2d"
+    "\x31\x20\x31\x20\x31\x20\x31\x20\x31\x20\x31\x20\x37\x20\x4b\x61"
+    "\x73\x70\x61\x72\x6f\x76\x20\x4b\x61\x72\x70\x6f\x76\x20\x30\x20"
+    "\x35\x20\x30\x20\x33\x39\x20\x33\x39\x20\x32\x39\x37\x20\x32\x39"
+    "\x38\x20\x32\x20\x4e\x2f\x67\x31\x2d\x66\x33\x20\x28\x30\x3a\x30"
+    "\x33\x29\x20\x4e\x66\x33\x20\x30\x20\x31\x20\x30\x0a",
+    // "<12> r-bqkbnr pppp-ppp --n----- ----p--- ----P--- -----N-- PPPP-PPP RNBQKB-R W -1 1 1 1 1 2 7 Kasparov Karpov 0 5 0 39 39 297 295 3 N/b8-c6 (0:03) Nc6 0 1 0"
+    "\x3c\x31\x32\x3e\x20\x72\x2d\x62\x71\x6b\x62\x6e\x72\x20\x70\x70"
+    "\x70\x70\x2d\x70\x70\x70\x20\x2d\x2d\x6e\x2d\x2d\x2d\x2d\x2d\x20"
+    "\x2d\x2d\x2d\x2d\x70\x2d\x2d\x2d\x20\x2d\x2d\x2d\x2d\x50\x2d\x2d"
+    "\x2d\x20\x2d\x2d\x2d\x2d\x2d\x4e\x2d\x2d\x20\x50\x50\x50\x50\x2d"
+    "\x50\x50\x50\x20\x52\x4e\x42\x51\x4b\x42\x2d\x52\x20\x57\x20\x2d"
+    "\x31\x20\x31\x20\x31\x20\x31\x20\x31\x20\x32\x20\x37\x20\x4b\x61"
+    "\x73\x70\x61\x72\x6f\x76\x20\x4b\x61\x72\x70\x6f\x76\x20\x30\x20"
+    "\x35\x20\x30\x20\x33\x39\x20\x33\x39\x20\x32\x39\x37\x20\x32\x39"
+    "\x35\x20\x33\x20\x4e\x2f\x62\x38\x2d\x63\x36\x20\x28\x30\x3a\x30"
+    "\x33\x29\x20\x4e\x63\x36\x20\x30\x20\x31\x20\x30\x0a",
+};
+
+// Rows of a games list, as the server sends them.  Also hex
+static const char *bench_games[] = {
+    // " 93 2036 WFMKierzek  2229 FMKarl     [ br  3   0]  2:22 -  3:06 (18-18) W: 42"
+    "\x20\x39\x33\x20\x32\x30\x33\x36\x20\x57\x46\x4d\x4b\x69\x65\x72"
+    "\x7a\x65\x6b\x20\x20\x32\x32\x32\x39\x20\x46\x4d\x4b\x61\x72\x6c"
+    "\x20\x20\x20\x20\x20\x5b\x20\x62\x72\x20\x20\x33\x20\x20\x20\x30"
+    "\x5d\x20\x20\x32\x3a\x32\x32\x20\x2d\x20\x20\x33\x3a\x30\x36\x20"
+    "\x28\x31\x38\x2d\x31\x38\x29\x20\x57\x3a\x20\x34\x32\x0a",
+    // "112 1887 Hankypanky  1902 Zugzwang   [ sr 15   0] 12:41 - 10:05 (35-36) B: 19"
+    "\x31\x31\x32\x20\x31\x38\x38\x37\x20\x48\x61\x6e\x6b\x79\x70\x61"
+    "\x6e\x6b\x79\x20\x20\x31\x39\x30\x32\x20\x5a\x75\x67\x7a\x77\x61"
+    "\x6e\x67\x20\x20\x20\x5b\x20\x73\x72\x20\x31\x35\x20\x20\x20\x30"
+    "\x5d\x20\x31\x32\x3a\x34\x31\x20\x2d\x20\x31\x30\x3a\x30\x35\x20"
+    "\x28\x33\x35\x2d\x33\x36\x29\x20\x42\x3a\x20\x31\x39\x0a",
+    // " 27 ++++ GuestQXWT    1411 Pawnstorm  [ bu  5   2]  3:56 -  4:12 (39-39) W:  8"
+    "\x20\x32\x37\x20\x2b\x2b\x2b\x2b\x20\x47\x75\x65\x73\x74\x51\x58"
+    "\x57\x54\x20\x20\x20\x20\x31\x34\x31\x31\x20\x50\x61\x77\x6e\x73"
+    "\x74\x6f\x72\x6d\x20\x20\x5b\x20\x62\x75\x20\x20\x35\x20\x20\x20"
+    "\x32\x5d\x20\x20\x33\x3a\x35\x36\x20\x2d\x20\x20\x34\x3a\x31\x32"
+    "\x20\x28\x33\x39\x2d\x33\x39\x29\x20\x57\x3a\x20\x20\x38\x0a",
+    // "204 2410 GMTactics   2388 IMEndgame  [pzr 10   5]  8:03 -  9:57 (24-24) B: 31"
+    "\x32\x30\x34\x20\x32\x34\x31\x30\x20\x47\x4d\x54\x61\x63\x74\x69"
+    "\x63\x73\x20\x20\x20\x32\x33\x38\x38\x20\x49\x4d\x45\x6e\x64\x67"
+    "\x61\x6d\x65\x20\x20\x5b\x70\x7a\x72\x20\x31\x30\x20\x20\x20\x35"
+    "\x5d\x20\x20\x38\x3a\x30\x33\x20\x2d\x20\x20\x39\x3a\x35\x37\x20"
+    "\x28\x32\x34\x2d\x32\x34\x29\x20\x42\x3a\x20\x33\x31\x0a",
+};
+
+/*-----------------------------------------------------------------------*/
+static void bench_report(const char *name, uint32_t cycles) {
+    sprintf(global.view.scratch_buffer, "%-16s %10lu cycles", name, (unsigned long)cycles);
+    log_add_line(&global.view.terminal, global.view.scratch_buffer, -1);
+}
+
+/*-----------------------------------------------------------------------*/
+void bench_run(void) {
+    uint32_t parse, games_parse, board, status, terminal;
+    uint8_t i, j;
+
+    // Parse the captured lines, the same way as if they came from the server
+    plat_core_bench_start();
+    for (i = 0; i < BENCH_STYLE12_LINES; i++) {
+        const char *line = bench_style12[i % AS(bench_style12)];
+        fics_bench_update(line, strlen(line));
+    }
+    parse = plat_core_bench_cycles();
+
+    // A games list, which the 8-bit machines cut down to the strongest few
+    games_bench_start();
+    plat_core_bench_start();
+    for (i = 0; i < BENCH_GAMES_ROWS; i++) {
+        const char *row = bench_games[i % AS(bench_games)];
+        fics_bench_table_feed(row, strlen(row));
+    }
+    games_parse = plat_core_bench_cycles();
+
+    // The board is now in the position of the last line
+    plat_core_active_term(false);
+    plat_core_bench_start();
+    plat_draw_board();
+    board = plat_core_bench_cycles();
+
+    // The parse filled the status panel
+    plat_core_bench_start();
+    plat_draw_log(&global.view.info_panel, plat_core_get_status_x(), 0, true);
+    status = plat_core_bench_cycles();
+    plat_draw_update();
+
+    // A full terminal of text
+    plat_core_active_term(true);
+    for (i = 0; i < global.view.terminal.rows; i++) {
+        for (j = 0; j < global.view.terminal.cols; j++) {
+            global.view.scratch_buffer[j] = 'a' + (i + j) % 26;
+        }
+        log_add_line(&global.view.terminal, global.view.scratch_buffer, global.view.terminal.cols);
+    }
+    plat_core_bench_start();
+    plat_draw_log(&global.view.terminal, 0, 0, false);
+    terminal = plat_core_bench_cycles();
+
+    log_clear(&global.view.terminal);
+    bench_report("style 12 x100", parse);
+    bench_report("games x100", games_parse);
+    bench_report("board", board);
+    bench_report("status panel", status);
+    bench_report("terminal", terminal);
+    log_add_line(&global.view.terminal, "Press a key", -1);
+    plat_core_active_term(true);
+    plat_draw_log(&global.view.terminal, 0, 0, false);
+    plat_draw_update();
+    plat_core_key_wait_any();
+}
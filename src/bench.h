@@ -0,0 +1,15 @@
+/*
+ *  bench.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+void bench_run(void);
+
+#endif //_BENCH_H_
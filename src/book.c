@@ -0,0 +1,294 @@
+/*
+ *  book.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "global.h"
+
+#ifdef RETROMATE_BOOK
+
+#define BOOK_KEY(k)             (((uint64_t)(k).hi << 32) | (k).lo)
+
+#ifdef RETROMATE_ENGINE
+#define BOOK_PANEL_Y            (plat_core_get_rows() - ENGINE_PANEL_ROWS - BOOK_PANEL_ROWS)
+#else
+#define BOOK_PANEL_Y            (plat_core_get_rows() - BOOK_PANEL_ROWS)
+#endif
+
+book_t book;
+
+// Openings are named by where their moves lead, so a game that gets there
+// another way is named too
+static const struct {
+    const char *moves;
+    const char *name;
+} book_lines[] = {
+    {"e2e4", "King's Pawn"},
+    {"e2e4 e7e5", "Open Game"},
+    {"e2e4 e7e5 g1f3 b8c6 f1b5", "Ruy Lopez"},
+    {"e2e4 e7e5 g1f3 b8c6 f1b5 g8f6", "Berlin Defence"},
+    {"e2e4 e7e5 g1f3 b8c6 f1c4", "Italian Game"},
+    {"e2e4 e7e5 g1f3 b8c6 f1c4 f8c5", "Giuoco Piano"},
+    {"e2e4 e7e5 g1f3 b8c6 f1c4 f8c5 b2b4", "Evans Gambit"},
+    {"e2e4 e7e5 g1f3 b8c6 f1c4 g8f6", "Two Knights"},
+    {"e2e4 e7e5 g1f3 b8c6 d2d4", "Scotch Game"},
+    {"e2e4 e7e5 g1f3 b8c6 b1c3 g8f6", "Four Knights"},
+    {"e2e4 e7e5 g1f3 g8f6", "Petrov"},
+    {"e2e4 e7e5 g1f3 d7d6", "Philidor"},
+    {"e2e4 e7e5 f2f4", "King's Gambit"},
+    {"e2e4 e7e5 b1c3", "Vienna Game"},
+    {"e2e4 c7c5", "Sicilian"},
+    {"e2e4 c7c5 c2c3", "Alapin"},
+    {"e2e4 c7c5 g1f3 d7d6 d2d4 c5d4 f3d4 g8f6 b1c3 a7a6", "Najdorf"},
+    {"e2e4 c7c5 g1f3 d7d6 d2d4 c5d4 f3d4 g8f6 b1c3 g7g6", "Dragon"},
+    {"e2e4 c7c5 g1f3 b8c6 d2d4 c5d4 f3d4 g8f6 b1c3 e7e5", "Sveshnikov"},
+    {"e2e4 e7e6", "French"},
+    {"e2e4 e7e6 d2d4 d7d5 e4e5", "French Advance"},
+    {"e2e4 e7e6 d2d4 d7d5 b1c3 f8b4", "French Winawer"},
+    {"e2e4 c7c6", "Caro-Kann"},
+    {"e2e4 c7c6 d2d4 d7d5 e4e5", "Caro-Kann Adv."},
+    {"e2e4 d7d5", "Scandinavian"},
+    {"e2e4 g8f6", "Alekhine"},
+    {"e2e4 d7d6 d2d4 g8f6 b1c3 g7g6", "Pirc"},
+    {"e2e4 g7g6", "Modern Defence"},
+    {"d2d4", "Queen's Pawn"},
+    {"d2d4 d7d5", "Closed Game"},
+    {"d2d4 d7d5 c1f4", "London System"},
+    {"d2d4 d7d5 c2c4", "Queen's Gambit"},
+    {"d2d4 d7d5 c2c4 d5c4", "QG Accepted"},
+    {"d2d4 d7d5 c2c4 e7e6", "QG Declined"},
+    {"d2d4 d7d5 c2c4 c7c6", "Slav"},
+    {"d2d4 d7d5 c2c4 c7c6 g1f3 g8f6 b1c3 e7e6", "Semi-Slav"},
+    {"d2d4 g8f6", "Indian Defence"},
+    {"d2d4 g8f6 c2c4 g7g6 b1c3 f8g7 e2e4 d7d6", "King's Indian"},
+    {"d2d4 g8f6 c2c4 g7g6 b1c3 d7d5", "Gruenfeld"},
+    {"d2d4 g8f6 c2c4 e7e6 b1c3 f8b4", "Nimzo-Indian"},
+    {"d2d4 g8f6 c2c4 e7e6 g1f3 b7b6", "Queen's Indian"},
+    {"d2d4 g8f6 c2c4 e7e6 g2g3", "Catalan"},
+    {"d2d4 g8f6 c2c4 c7c5 d4d5 e7e6", "Benoni"},
+    {"d2d4 g8f6 c2c4 c7c5 d4d5 b7b5", "Benko Gambit"},
+    {"d2d4 f7f5", "Dutch"},
+    {"c2c4", "English"},
+    {"g1f3", "Reti"},
+    {"f2f4", "Bird"},
+    {"b2b3", "Larsen"},
+};
+
+static book_opening_t book_openings[AS(book_lines)];
+
+/*-----------------------------------------------------------------------*/
+static int book_compare(const void *a, const void *b) {
+    uint64_t ka = ((const book_opening_t *)a)->key;
+    uint64_t kb = ((const book_opening_t *)b)->key;
+    return ka < kb ? -1 : ka > kb;
+}
+
+/*-----------------------------------------------------------------------*/
+static uint64_t book_entry_key(uint32_t index) {
+    const uint8_t *entry = book.entries + index * BOOK_ENTRY_SIZE;
+    uint64_t key = 0;
+    uint8_t i;
+
+    for (i = 0; i < 8; i++) {
+        key = (key << 8) | entry[i];
+    }
+    return key;
+}
+
+/*-----------------------------------------------------------------------*/
+// A Polyglot move as text.  Castling is the king taking its own rook
+static uint8_t book_move_text(uint16_t poly, char *text) {
+    static const uint8_t promote[8] = {NONE, KNIGHT, BISHOP, ROOK, QUEEN, NONE, NONE, NONE};
+    move_t m;
+    uint8_t to_file = poly & 7;
+    uint8_t from_file = (poly >> 6) & 7;
+    uint8_t from_rank = (poly >> 9) & 7;
+    char piece = global.state.chess_board[(7 - from_rank) * 8 + from_file];
+
+    // 'K' 'k'
+    if ((piece == '\x4b' || piece == '\x6b') && from_file == 4 && (to_file == 0 || to_file == 7)) {
+        to_file = to_file ? 6 : 2;
+    }
+    m.from = MOVEGEN_SQUARE(from_rank, from_file);
+    m.to = MOVEGEN_SQUARE((poly >> 3) & 7, to_file);
+    m.promote = promote[(poly >> 12) & 7];
+    m.flags = 0;
+    return movegen_move_text(&m, text);
+}
+
+/*-----------------------------------------------------------------------*/
+// Play the moves, as movegen_move_text writes them, from the start
+static bool book_play(position_t *p, const char *moves) {
+    move_t list[MOVEGEN_MAX_MOVES];
+    char text[6];
+    undo_t u;
+    uint8_t count, i, len;
+
+    movegen_set_fen(p, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+    while (*moves) {
+        len = strcspn(moves, " ");
+        count = movegen_generate(p, list);
+        for (i = 0; i < count; i++) {
+            if (movegen_move_text(&list[i], text) == len && !strncmp(text, moves, len) && movegen_make(p, &list[i], &u)) {
+                break;
+            }
+        }
+        if (i == count) {
+            return false;
+        }
+        moves += len;
+        while (*moves == '\x20') {  // ' '
+            moves++;
+        }
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+// The panel's 2 rows, drawn next time round
+void book_clear(void) {
+    book.name = NULL;
+    log_clear(&book.panel);
+    while (book.panel.size < BOOK_PANEL_ROWS) {
+        log_add_line(&book.panel, "\x0a", 1);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+void book_draw_update(void) {
+    if (book.panel.modified) {
+        plat_draw_log(&book.panel, plat_core_get_status_x(), BOOK_PANEL_Y, true);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+void book_init(void) {
+    position_t p;
+    zobrist_key_t key;
+    const char *path;
+    uint8_t i;
+
+    log_init(&book.panel, global.view.info_panel.cols, BOOK_PANEL_ROWS);
+    book.panel.clip = true;
+
+    path = getenv("RETROMATE_BOOK");
+    book.entries = plat_core_file_map(path ? path : BOOK_FILE, &book.size);
+    book.count = book.size / BOOK_ENTRY_SIZE;
+
+    for (i = 0; i < AS(book_lines); i++) {
+        book_openings[i].name = book_lines[i].name;
+        if (book_play(&p, book_lines[i].moves)) {
+            zobrist_position_key(&p, &key);
+            book_openings[i].key = BOOK_KEY(key);
+        }
+    }
+    qsort(book_openings, AS(book_openings), sizeof(book_opening_t), book_compare);
+}
+
+/*-----------------------------------------------------------------------*/
+// Look up the position style 12 just brought in.  A couple of binary
+// searches, so it's done as the line is parsed.  Book moves aren't shown in
+// a game being played, only the opening's name
+void book_position(void) {
+    uint64_t key = BOOK_KEY(zobrist.key);
+    position_t p;
+    uint16_t moves[BOOK_MOVES_SHOWN];
+    uint16_t weights[BOOK_MOVES_SHOWN];
+    char line[BOOK_MOVES_SHOWN * 6 + 1];
+    uint32_t lo, hi, mid;
+    uint8_t found = 0, len = 0, i, j;
+    const uint8_t *entry;
+    uint16_t weight;
+
+    // No king, say, so nothing to look up, and book_move_text can't be used
+    if (!movegen_set_frame(&p, global.state.chess_board, &global.frame)) {
+        book_clear();
+        return;
+    }
+
+    // The first position of a game
+    if (zobrist.history_count == 1) {
+        book.name = NULL;
+    }
+
+    lo = 0;
+    hi = AS(book_openings);
+    while (lo < hi) {
+        mid = (lo + hi) >> 1;
+        if (book_openings[mid].key < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < AS(book_openings) && book_openings[lo].key == key) {
+        book.name = book_openings[lo].name;
+    }
+
+    if (book.entries && !(global.state.game_active && global.state.includes_me)) {
+        lo = 0;
+        hi = book.count;
+        while (lo < hi) {
+            mid = (lo + hi) >> 1;
+            if (book_entry_key(mid) < key) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        // Keep the heaviest few, heaviest first
+        for (; lo < book.count && book_entry_key(lo) == key; lo++) {
+            entry = book.entries + lo * BOOK_ENTRY_SIZE;
+            weight = (entry[10] << 8) | entry[11];
+            for (i = found; i && weights[i - 1] < weight; i--) {
+            }
+            if (i < BOOK_MOVES_SHOWN) {
+                for (j = MIN(found, BOOK_MOVES_SHOWN - 1); j > i; j--) {
+                    moves[j] = moves[j - 1];
+                    weights[j] = weights[j - 1];
+                }
+                moves[i] = (entry[8] << 8) | entry[9];
+                weights[i] = weight;
+                if (found < BOOK_MOVES_SHOWN) {
+                    found++;
+                }
+            }
+        }
+        for (i = 0; i < found; i++) {
+            if (len) {
+                line[len++] = '\x20';       // ' '
+            }
+            len += book_move_text(moves[i], line + len);
+        }
+    }
+
+    log_clear(&book.panel);
+    if (book.name) {
+        log_add_line(&book.panel, book.name, -1);
+    } else {
+        log_add_line(&book.panel, "\x0a", 1);
+    }
+    if (len) {
+        log_add_line(&book.panel, line, len);
+    } else {
+        log_add_line(&book.panel, "\x0a", 1);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+void book_shutdown(void) {
+    if (book.entries) {
+        plat_core_file_unmap(book.entries, book.size);
+        book.entries = NULL;
+    }
+    log_shutdown(&book.panel);
+}
+
+#endif // RETROMATE_BOOK
@@ -0,0 +1,46 @@
+/*
+ *  book.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#ifndef _BOOK_H_
+#define _BOOK_H_
+
+#ifdef RETROMATE_BOOK
+
+// A Polyglot book is looked up with zobrist.key, made with Polyglot's keys
+#define BOOK_FILE               "book.bin"      // Or set RETROMATE_BOOK
+#define BOOK_ENTRY_SIZE         16              // Key 8, move 2, weight 2, learn 4, big endian
+#define BOOK_MOVES_SHOWN        3
+// The panel is above the engine's, at the bottom of the info panel
+#define BOOK_PANEL_ROWS         2
+
+// A named opening, keyed by the position its moves lead to
+typedef struct _book_opening {
+    uint64_t key;
+    const char *name;
+} book_opening_t;
+
+typedef struct _book {
+    const uint8_t *entries;         // Mapped, sorted by key, or NULL
+    uint32_t size;                  // Bytes mapped
+    uint32_t count;                 // Entries
+    const char *name;               // Last opening the game went through
+    tLog panel;
+} book_t;
+
+extern book_t book;
+
+void book_clear(void);
+void book_draw_update(void);
+void book_init(void);
+void book_position(void);
+void book_shutdown(void);
+
+#endif // RETROMATE_BOOK
+
+#endif // _BOOK_H_
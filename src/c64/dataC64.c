@@ -1,161 +0,0 @@
-/*
- *  dataC64.c
- *  cc65 Chess
- *
- *  Created by Stefan Wessels, February 2014.
- *
- */
-
-#include "../global.h"
-
-#include "platC64.h"
-
-/*-----------------------------------------------------------------------*/
-// C64 specific graphics for the chess pieces
-// 72 = 8 rows (character heigt) * 3 colomns (width) * 3 (character lines [of 8 rows and 3 columns each])
-char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT] = {
-    {
-        {
-            0x00, 0x00, 0x1E, 0x12, 0x12, 0x13, 0x10, 0x08,
-            0x00, 0x00, 0x3E, 0x22, 0x22, 0xE3, 0x00, 0x00,
-            0x00, 0x00, 0x3C, 0x24, 0x24, 0xE4, 0x04, 0x08,
-            0x04, 0x02, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01,
-            0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x10, 0xA0, 0x60, 0x40, 0x40, 0x40, 0x40, 0x40,
-            0x02, 0x04, 0x05, 0x08, 0x1F, 0x1F, 0x00, 0x00,
-            0x00, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-            0x20, 0x10, 0xD0, 0x08, 0xFC, 0xFC, 0x00, 0x00,
-        },
-        {
-            0x00, 0x00, 0x1E, 0x1E, 0x1E, 0x1F, 0x1F, 0x0F,
-            0x00, 0x00, 0x3E, 0x3E, 0x3E, 0xFF, 0xFF, 0xFF,
-            0x00, 0x00, 0x3C, 0x3C, 0x3C, 0xFC, 0xFC, 0xF8,
-            0x07, 0x03, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01,
-            0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-            0xF0, 0xE0, 0x20, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
-            0x03, 0x07, 0x07, 0x08, 0x1F, 0x1F, 0x00, 0x00,
-            0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-            0xE0, 0xF0, 0xF0, 0x08, 0xFC, 0xFC, 0x00, 0x00,
-        },
-    },
-    {
-        {
-            0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02,
-            0x00, 0x00, 0x44, 0xAA, 0x09, 0x00, 0x00, 0x21,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x40,
-            0x02, 0x04, 0x08, 0x10, 0x10, 0x09, 0x06, 0x00,
-            0x01, 0x01, 0x00, 0x00, 0xF0, 0x08, 0x10, 0x20,
-            0x40, 0xA0, 0xA0, 0x20, 0x20, 0xB0, 0xD0, 0x48,
-            0x00, 0x00, 0x01, 0x02, 0x02, 0x03, 0x00, 0x00,
-            0x40, 0x80, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-            0x28, 0x0C, 0x04, 0xF4, 0x04, 0xFC, 0x00, 0x00,
-        },
-        {
-            0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x03, 0x03,
-            0x00, 0x00, 0x44, 0xAA, 0xF7, 0xFF, 0xFF, 0xDE,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0,
-            0x03, 0x07, 0x0F, 0x1F, 0x1F, 0x0F, 0x06, 0x00,
-            0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0x0F, 0x1F, 0x3F,
-            0xC0, 0x60, 0x60, 0xE0, 0xE0, 0x70, 0x30, 0xB8,
-            0x00, 0x00, 0x01, 0x02, 0x03, 0x03, 0x00, 0x00,
-            0x7F, 0xFF, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-            0xD8, 0xFC, 0xFC, 0x04, 0xFC, 0xFC, 0x00, 0x00,
-        },
-    },
-    {
-        {
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-            0x00, 0x00, 0x00, 0x1C, 0x22, 0x41, 0x88, 0x08,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40,
-            0x01, 0x02, 0x02, 0x02, 0x01, 0x01, 0x00, 0x00,
-            0x7F, 0x08, 0x08, 0x08, 0x08, 0x00, 0x80, 0x7F,
-            0x40, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x00,
-            0x00, 0x00, 0x00, 0x01, 0x07, 0x0F, 0x00, 0x00,
-            0x41, 0x41, 0x3E, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x40, 0xF0, 0xF8, 0x00, 0x00,
-        },
-        {
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-            0x00, 0x00, 0x00, 0x1C, 0x3E, 0x7F, 0xF7, 0xF7,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0,
-            0x01, 0x03, 0x03, 0x03, 0x01, 0x01, 0x00, 0x00,
-            0x80, 0xF7, 0xF7, 0xF7, 0xF7, 0xFF, 0xFF, 0x41,
-            0xC0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x00,
-            0x00, 0x00, 0x00, 0x01, 0x04, 0x0F, 0x00, 0x00,
-            0x7F, 0x7F, 0x3E, 0xFF, 0x00, 0xFF, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0xC0, 0x10, 0xF8, 0x00, 0x00,
-        },
-    },
-    {
-        {
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x08, 0x10,
-            0x00, 0x00, 0x00, 0x1C, 0x22, 0x22, 0x94, 0xA2,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x88, 0x84,
-            0x11, 0x10, 0x11, 0x11, 0x08, 0x08, 0x04, 0x04,
-            0x41, 0x00, 0x08, 0x9C, 0xFF, 0x7F, 0x00, 0x00,
-            0x44, 0x04, 0x44, 0xC4, 0x88, 0x08, 0x10, 0x10,
-            0x05, 0x02, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00,
-            0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-            0xD0, 0x20, 0x20, 0x20, 0x60, 0xC0, 0x00, 0x00,
-        },
-        {
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x1F,
-            0x00, 0x00, 0x00, 0x1C, 0x3E, 0x3E, 0x9C, 0xBE,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xF8, 0xFC,
-            0x1F, 0x1F, 0x1E, 0x1E, 0x0F, 0x0F, 0x07, 0x07,
-            0x7F, 0xFF, 0xF7, 0x63, 0x00, 0x80, 0xFF, 0xFF,
-            0x7C, 0xFC, 0xBC, 0x3C, 0x78, 0xF8, 0xF0, 0xF0,
-            0x06, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00,
-            0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-            0x30, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00,
-        },
-    },
-    {
-        {
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
-            0x00, 0x00, 0x1C, 0x14, 0x77, 0x63, 0x94, 0x55,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x20,
-            0x04, 0x08, 0x09, 0x12, 0x12, 0x11, 0x08, 0x08,
-            0x36, 0x14, 0x22, 0x14, 0x08, 0x08, 0x80, 0x41,
-            0x10, 0x08, 0x48, 0x24, 0x24, 0x44, 0x88, 0x08,
-            0x04, 0x04, 0x02, 0x02, 0x03, 0x01, 0x00, 0x00,
-            0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-            0x10, 0x90, 0x20, 0x20, 0x60, 0xC0, 0x00, 0x00,
-        },
-        {
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03,
-            0x00, 0x00, 0x1C, 0x14, 0x77, 0x63, 0x94, 0xD5,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0,
-            0x07, 0x0F, 0x0E, 0x1D, 0x1D, 0x1E, 0x0F, 0x0F,
-            0xF7, 0xE3, 0xD5, 0xE3, 0xF7, 0xFF, 0x7F, 0xBE,
-            0xF0, 0xF8, 0xB8, 0xDC, 0xDC, 0xBC, 0x78, 0xF8,
-            0x07, 0x06, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00,
-            0xFF, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-            0xF0, 0x30, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00,
-        },
-    },
-    {
-        {
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x22,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x41, 0x41, 0x41, 0x22, 0x1C, 0x22, 0x22, 0x63,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
-            0x22, 0x22, 0x7F, 0x80, 0xFF, 0xFF, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0x00, 0x00,
-        },
-        {
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3E,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x7F, 0x7F, 0x7F, 0x3E, 0x1C, 0x3E, 0x3E, 0x7F,
-            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
-            0x3E, 0x3E, 0x7F, 0x80, 0xFF, 0xFF, 0x00, 0x00,
-            0x00, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0x00, 0x00,
-        },
-    },
-};
@@ -7,12 +7,13 @@
 ;
 ;
 
-.export _hires_draw, _hires_mask, _hires_color
+.export _hires_draw, _hires_mask, _hires_color, _hires_square, _hires_pieces
+.constructor unpack_pieces
 
 .include "c64.inc"
 .include "zeropage.inc"
 
-.import popa, popax, _hires_piece
+.import popa, popax, pieces_rle
 
 .rodata
 
@@ -20,6 +21,10 @@
 .define SCREEN_RAM      VIC_BASE_RAM + $2000
 .define CHARMAP_RAM     VIC_BASE_RAM + $2800
 
+; The piece tiles live in the RAM under the Kernal ROM, so they don't take
+; program memory.  Everything that reads them has $01 = $34 already
+_hires_pieces   := $F000
+
 BASELO:
     .repeat 25, I
     .byte   <(VIC_BASE_RAM + 320 * I)
@@ -40,6 +45,44 @@ CBASEHI:
     .byte   >(SCREEN_RAM + 40 * I)
     .endrep
 
+; hires_square tables.  Squares are 3x3 characters, starting 1 character in
+SQUARE_FILL     = $80
+SQUARE_INVERT   = $40
+SQUARE_TILE     = $0F
+
+; Top left of each square in the bitmap
+SQUARELO:
+    .repeat 64, I
+    .byte   <(VIC_BASE_RAM + 320 * 3 * (I / 8) + 8 * (1 + 3 * (I .mod 8)))
+    .endrep
+
+SQUAREHI:
+    .repeat 64, I
+    .byte   >(VIC_BASE_RAM + 320 * 3 * (I / 8) + 8 * (1 + 3 * (I .mod 8)))
+    .endrep
+
+; Top left of each square in the color (screen) RAM
+CSQUARELO:
+    .repeat 64, I
+    .byte   <(SCREEN_RAM + 40 * 3 * (I / 8) + 1 + 3 * (I .mod 8))
+    .endrep
+
+CSQUAREHI:
+    .repeat 64, I
+    .byte   >(SCREEN_RAM + 40 * 3 * (I / 8) + 1 + 3 * (I .mod 8))
+    .endrep
+
+; The 12 piece tiles, hires_pieces[piece][inv], of 72 bytes each
+TILELO:
+    .repeat 12, I
+    .byte   <(_hires_pieces + 72 * I)
+    .endrep
+
+TILEHI:
+    .repeat 12, I
+    .byte   >(_hires_pieces + 72 * I)
+    .endrep
+
 .code
 
 .proc   _hires_draw
@@ -151,7 +194,7 @@ ymax:   cpx #$FF    ; Patched
         jsr popa    ; 'xpos'
         sta xpos+1
 
-        ; clc
+        clc
         adc xmax+1
         sta xmax+1
 
@@ -172,7 +215,7 @@ ymax:   cpx #$FF    ; Patched
         sta 1
 
         ldy ypos+1
-        ; clc
+        clc
 xofflo: lda #$FF ; Patched
         adc BASELO,y
         sta src+1
@@ -238,7 +281,7 @@ ymax:   cpy #$FF    ; Patched
         jsr popa    ; 'xpos'
         sta xpos+1
 
-        ; clc
+        clc
         adc xmax+1
         sta xmax+1
 
@@ -268,3 +311,156 @@ ymax:   cpy #$FF    ; Patched
         cli
         rts
 .endproc
+
+
+; void hires_square(unsigned tile_position)
+; A = position 0..63, X = tile (piece * 2 + inv) | SQUARE_FILL | SQUARE_INVERT
+; Draws a whole board square, and colors it, without the C stack.  The 3
+; characters in a character row are 24 bytes in a row, both in the tile and
+; in the bitmap, so one 24 step loop does all 9 characters, a row at a time
+.proc   _hires_square
+
+        tay                 ; 'position'
+        clc
+        lda SQUARELO,y      ; Character row 0, 1 and 2 destinations
+        sta dst0+1
+        adc #<320
+        sta dst1+1
+        lda SQUAREHI,y
+        sta dst0+2
+        adc #>320
+        sta dst1+2
+        clc
+        lda dst1+1
+        adc #<320
+        sta dst2+1
+        lda dst1+2
+        adc #>320
+        sta dst2+2
+
+        lda CSQUARELO,y
+        sta ptr1
+        lda CSQUAREHI,y
+        sta ptr1+1
+
+        lda #$49            ; eor #
+        cpx #SQUARE_FILL
+        bcc :+
+        lda #$A9            ; lda # - nothing to copy, just fill
+:       sta rop0
+        sta rop1
+        sta rop2
+        txa
+        and #SQUARE_INVERT
+        beq :+
+        lda #$FF
+:       sta rop0+1
+        sta rop1+1
+        sta rop2+1
+
+        txa                 ; Source rows for character row 0, 1 and 2
+        and #SQUARE_TILE
+        tay
+        clc
+        lda TILELO,y
+        sta src0+1
+        adc #24
+        sta src1+1
+        lda TILEHI,y
+        sta src0+2
+        adc #0
+        sta src1+2
+        clc
+        lda src1+1
+        adc #24
+        sta src2+1
+        lda src1+2
+        adc #0
+        sta src2+2
+
+        sei
+        lda #$34
+        sta 1
+
+        ldy #23
+loop:
+src0:   lda $FFFF,y         ; Patched
+rop0:   nop                 ; Patched
+        nop
+dst0:   sta $FFFF,y         ; Patched
+src1:   lda $FFFF,y         ; Patched
+rop1:   nop                 ; Patched
+        nop
+dst1:   sta $FFFF,y         ; Patched
+src2:   lda $FFFF,y         ; Patched
+rop2:   nop                 ; Patched
+        nop
+dst2:   sta $FFFF,y         ; Patched
+        dey
+        bpl loop
+
+        lda #(COLOR_WHITE << 4)
+        .repeat 3, R
+        .repeat 3, C
+        ldy #(40 * R + C)
+        sta (ptr1),y
+        .endrep
+        .endrep
+
+        lda #$36
+        sta 1
+        cli
+        rts
+.endproc
+
+
+.segment "ONCE"
+
+; Unpack the RLE piece tiles (see cmake/GenPieces.cmake) to _hires_pieces.
+; Writes go to the RAM under the ROM, so no banking is needed.  This runs
+; before main, and ONCE is then reused as BSS
+.proc   unpack_pieces
+        lda #<pieces_rle
+        sta ptr1
+        lda #>pieces_rle
+        sta ptr1+1
+        lda #<_hires_pieces
+        sta ptr2
+        lda #>_hires_pieces
+        sta ptr2+1
+
+next:   jsr get
+        tax
+        beq done    ; $00 ends
+        bmi run
+
+copy:   jsr get     ; $01..$7F literal bytes
+        jsr put
+        dex
+        bne copy
+        beq next
+
+run:    and #$7F    ; $81..$FF repeats of the next byte
+        tax
+        jsr get
+:       jsr put
+        dex
+        bne :-
+        beq next
+
+done:   rts
+
+get:    ldy #0
+        lda (ptr1),y
+        inc ptr1
+        bne :+
+        inc ptr1+1
+:       rts
+
+put:    ldy #0
+        sta (ptr2),y
+        inc ptr2
+        bne :+
+        inc ptr2+1
+:       rts
+.endproc
@@ -10,6 +10,8 @@
 #ifndef _PLATC64_H_
 #define _PLATC64_H_
 
+#include <em.h>         // struct em_copy
+
 /*-----------------------------------------------------------------------*/
 // These are text based coordinates
 #define SCREEN_TEXT_WIDTH       40
@@ -28,6 +30,9 @@
 #define BOARD_START_X           CHARACTER_WIDTH
 #define BOARD_START_Y           0
 
+// The settings, on the disk in the drive it loaded from
+#define CONFIG_FILE_NAME        "retromate.cfg"
+
 #define VIC_BASE_RAM            (0xC000)
 #define BITMAP_OFFSET           (0x0000)
 #define CHARMAP_ROM             (0xD000)
@@ -49,6 +54,9 @@
 #define ROP_INV                 0x49FF
 #define ROP_AND(val)            0x2900|(val)
 
+// Terminal history rows in the REU, 3 to a 256 byte page
+#define HISTORY_ROWS_PER_PAGE   (256 / LOG_HISTORY_COLS)
+
 void plat_core_hires(bool on);
 void hires_draw(char xpos,    char ypos,
                 char xsize,   char ysize,
@@ -59,6 +67,11 @@ void hires_mask(char xpos,    char ypos,
 void hires_color(char xpos,   char ypos,
                  char xsize,  char ysize,
                  char color);
+// hires_square takes the tile (piece * 2 + inv, or SQUARE_FILL) in the high
+// byte and the position (0..63) in the low byte
+#define SQUARE_FILL             0x80
+#define SQUARE_INVERT           0x40
+void hires_square(unsigned tile_position);
 
 /*-----------------------------------------------------------------------*/
 typedef struct _c64 {
@@ -74,9 +87,17 @@ typedef struct _c64 {
     char send_buffer[80];
     char terminal_log_buffer[80 * 24];
     char status_log_buffer[13 * 25];
+    struct em_copy history_copy;
+    char history_row[80];
 } c64_t;
 
 extern c64_t c64;
+// Under the Kernal ROM (see hiresC64.s) - only pass it to hires_draw, don't read it
 extern char hires_pieces[6][2][SQUARE_TEXT_WIDTH * SQUARE_DISPLAY_HEIGHT];
+// Made by cmake/GenCharmaps.cmake
+extern const uint8_t charmap_ascii_to_log[256];
+extern const uint8_t charmap_log_to_petscii[256];
+extern const uint8_t charmap_log_to_screen[256];
+extern const uint8_t charmap_petscii_to_ascii[256];   // 0 is a byte not to send
 
 #endif //_PLATC64_H_
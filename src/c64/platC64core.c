@@ -9,8 +9,11 @@
 
 #include <c64.h>
 #include <conio.h>  // kbhit, cgetc
+#include <fcntl.h>  // open
+#include <stdio.h>  // remove
 #include <stdlib.h> // exit
 #include <string.h> // memcpy
+#include <unistd.h> // read, write, close
 
 #include "../global.h"
 
@@ -66,16 +69,64 @@ void plat_core_active_term(bool active) {
     }
 }
 
+#ifdef RETROMATE_BENCH
+/*-----------------------------------------------------------------------*/
+// CIA 2 timer A counts cycles and timer B counts timer A underflows, so
+// together they count down, 32 bits wide
+void plat_core_bench_start(void) {
+    CIA2.icr = 0x7f;    // No NMIs from the timers
+    CIA2.cra = 0;
+    CIA2.crb = 0;
+    CIA2.ta_lo = 0xff;
+    CIA2.ta_hi = 0xff;
+    CIA2.tb_lo = 0xff;
+    CIA2.tb_hi = 0xff;
+    CIA2.crb = 0x51;    // Load, count timer A underflows, start
+    CIA2.cra = 0x11;    // Load, count cycles, start
+}
+
+/*-----------------------------------------------------------------------*/
+uint32_t plat_core_bench_cycles(void) {
+    uint16_t a, b;
+    CIA2.cra = 0;       // Stopping A stops B too
+    a = CIA2.ta_lo | CIA2.ta_hi << 8;
+    b = CIA2.tb_lo | CIA2.tb_hi << 8;
+    return ~((uint32_t)b << 16 | a);
+}
+#endif
+
+/*-----------------------------------------------------------------------*/
+bool plat_core_config_load(void *data, uint8_t size) {
+    int fd = open(CONFIG_FILE_NAME, O_RDONLY);
+    bool loaded;
+
+    if (fd < 0) {
+        return false;
+    }
+    loaded = read(fd, data, size) == size;
+    close(fd);
+    return loaded;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_config_save(const void *data, uint8_t size) {
+    int fd;
+
+    // CBM DOS won't write over a file, so the old one goes first
+    remove(CONFIG_FILE_NAME);
+    fd = open(CONFIG_FILE_NAME, O_WRONLY | O_CREAT | O_TRUNC);
+    if (fd >= 0) {
+        write(fd, data, size);
+        close(fd);
+    }
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_core_copy_ascii_to_display(void *dest, const void *src, size_t n) {
     char *from = (char*)src;
     char *to = (char*)dest;
     while (n--) {
-        char c = *from++;
-        if (c >= 65 && c < 91) {    // 'A-Z' to PETSCII
-            c |= 0x80;
-        }
-        *to++ = c;
+        *to++ = charmap_ascii_to_log[(uint8_t)*from++];
     }
 }
 
@@ -100,6 +151,45 @@ uint8_t plat_core_get_status_x(void) {
     return 2 + SQUARE_TEXT_WIDTH * 8;
 }
 
+/*-----------------------------------------------------------------------*/
+// Point the REU copy at a history slot.  Rows don't straddle REU pages
+static void plat_core_history_slot(uint16_t slot, const char *buf) {
+    c64.history_copy.buf = (void *)buf;
+    c64.history_copy.page = slot / HISTORY_ROWS_PER_PAGE;
+    c64.history_copy.offs = (slot % HISTORY_ROWS_PER_PAGE) * LOG_HISTORY_COLS;
+    c64.history_copy.count = LOG_HISTORY_COLS;
+}
+
+/*-----------------------------------------------------------------------*/
+const char *plat_core_history_get(uint16_t slot) {
+    plat_core_history_slot(slot, c64.history_row);
+    em_copyfrom(&c64.history_copy);
+    return c64.history_row;
+}
+
+/*-----------------------------------------------------------------------*/
+// The terminal history lives in a REU (1700/1750/1764 or compatible), if
+// the driver finds one.  Without, there's just the screen of log
+uint16_t plat_core_history_init(void) {
+    unsigned pages;
+
+    if (em_install(c64_reu_emd) != EM_ERR_OK) {
+        return 0;
+    }
+    pages = em_pagecount();
+    if (pages > LOG_HISTORY_MAX / HISTORY_ROWS_PER_PAGE) {
+        pages = LOG_HISTORY_MAX / HISTORY_ROWS_PER_PAGE;
+    }
+    return pages * HISTORY_ROWS_PER_PAGE;
+}
+
+/*-----------------------------------------------------------------------*/
+// The REU DMAs the row straight out of the log
+void plat_core_history_put(uint16_t slot, const char *row) {
+    plat_core_history_slot(slot, row);
+    em_copyto(&c64.history_copy);
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_core_hires(bool on) {
     if (on) {
@@ -131,13 +131,7 @@ c64_t c64 = {
 /*-----------------------------------------------------------------------*/
 // x in Character coords, y in Graphics coords
 void plat_draw_char(char x, char y, unsigned rop, char c) {
-    if (c >= 'A' && c <= 'Z') {
-        c &= 0x7f;
-    } else if (c >= 65 && c <= 90) {
-        c -= 64;    // Lowercase to 1-26
-    } else if(c >= 97 && c <= 123) {
-        c -= 96;    // Lowercase ascii to 1-26
-    }
+    c = charmap_log_to_screen[(uint8_t)c];
     hires_draw(x, y, 1, 1, rop, CHARMAP_RAM + c * 8);
     hires_color(x, y, 1, 1, c64.draw_colors);
 }
@@ -258,14 +252,10 @@ void plat_draw_highlight(uint8_t position, uint8_t color) {
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool) {
-    int i;
-    char *log_end = log->buffer + log->buffer_size;
-    char *log_render = log->buffer;
+    uint8_t i;
+    uint8_t pan = 0;
     uint8_t width = log->cols;
 
-    if (log->size >= log->rows) {
-        log_render += log->cols * log->head;
-    }
     log->modified = false;
 
     c64.draw_colors = COLOR_BLACK << 4 | COLOR_GREEN;
@@ -277,15 +267,11 @@ void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool) {
             global.view.pan_value = 0;
         }
         width = SCREEN_TEXT_WIDTH;
-        log_render += 20 * shift;
+        pan = 20 * shift;
     }
 
     for (i = 0; i < log->size; ++i) {
-        plat_draw_text(x, y++, log_render, width);
-        log_render += log->cols;
-        if (log_render >= log_end) {
-            log_render = log->buffer + (log_render - log_end);
-        }
+        plat_draw_text(x, y++, log_row(log, i) + pan, width);
     }
 }
 
@@ -334,27 +320,23 @@ void plat_draw_splash_screen() {
 /*-----------------------------------------------------------------------*/
 // Draw a tile with background and piece on it for positions 0..63
 void plat_draw_square(uint8_t position) {
-    unsigned rop;
-    uint8_t inv;
+    uint8_t tile;
     uint8_t y = position / 8;
     uint8_t x = position & 7;
     uint8_t piece = fics_letter_to_piece(global.state.chess_board[position]);
     bool black_or_white = !((x & 1) ^ (y & 1));
 
     if (piece) {
-        rop = black_or_white ? ROP_INV : ROP_CPY;
-        inv = black_or_white ^ !((piece & PIECE_WHITE) == 0);
+        tile = ((piece & 127) - 1) * 2 + (black_or_white ^ !((piece & PIECE_WHITE) == 0));
     } else {
-        rop = black_or_white ? ROP_WHITE : ROP_BLACK;
-        inv = 0;
-        piece = 1;
+        tile = SQUARE_FILL;
+    }
+    if (black_or_white) {
+        tile |= SQUARE_INVERT;
     }
 
-    hires_draw(1 + x * SQUARE_TEXT_WIDTH, y * SQUARE_TEXT_HEIGHT,
-               SQUARE_TEXT_WIDTH, SQUARE_TEXT_HEIGHT, rop,
-               hires_pieces[(piece & 127) - 1][inv]);
-    hires_color(1 + x * SQUARE_TEXT_WIDTH, y * SQUARE_TEXT_HEIGHT,
-                SQUARE_TEXT_WIDTH, SQUARE_TEXT_HEIGHT, COLOR_WHITE<<4);
+    // Draws and colors the square in one go
+    hires_square((unsigned)tile << 8 | position);
 }
 
 /*-----------------------------------------------------------------------*/
@@ -362,14 +344,7 @@ void plat_draw_text(uint8_t x, uint8_t y, const char *text, uint8_t len) {
     if (global.view.terminal_active) {
         gotoxy(x, y);
         while (len--) {
-            // cputc(*text++);
-            char c = *text++;
-            if (c >= 65 && c < 91) {
-                c |= 32;
-            } else if (c >= 97 && c < 123) {
-                c &= ~32;
-            }
-            cputc(c);
+            cputc(charmap_log_to_petscii[(uint8_t)*text++]);
         }
     } else {
         while (len) {
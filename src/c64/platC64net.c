@@ -17,22 +17,11 @@
 /*-----------------------------------------------------------------------*/
 static int plat_net_make_ascii(const char *text) {
     char i = 0;
+    uint8_t c;
     while (*text) {
-        char c = *text;
-        if(c == 0x0d) { // \r to \n
-            c64.send_buffer[i++] = 0x0a;
-        } else if (c < 219 && c >= 32) {    // ignore too small and big
-            if(c >= 193) { // Petscii 'A-Z' to Ascii 'A-Z'
-               c64.send_buffer[i++] = c & ~128;
-            } else if(c < 123) { // Ignore 123 - 192
-                if(c >= 91 || c < 65) {  // pass all (that remains), but 'a-z', as-is
-                    c64.send_buffer[i++] = c;
-                } else {    // Petscii 'a-z' to Ascii 'a-z'
-                    c64.send_buffer[i++] = c | 32;
-                }
-            }
+        if ((c = charmap_petscii_to_ascii[(uint8_t)*text++])) {
+            c64.send_buffer[i++] = c;
         }
-        text++;
     }
     c64.send_buffer[i++] = '\x0a';
     return i;
@@ -23,8 +23,11 @@
     terminal_display_width .res 1
     prev_mod               .res 1
     tv_standard            .res 1
-    send_buffer            .res 80*24   ; I need access to this buffer
+    send_buffer            .res 80      ; I need access to this buffer
+    terminal_log_buffer    .res 80*24
     status_log_buffer      .res 13*25
+    history_copy           .res 8       ; struct em_copy
+    history_row            .res 80
 .endstruct
 
 base        = $DE00         ; base ACIA address
@@ -33,10 +36,19 @@ status      = base+1        ; ready to receive / send
 command     = base+2        ; parity, echo, irq's and rx/tx on/off
 control     = base+3        ; stop bits / baud
 turbo232    = $DE07         ; turbo232 baud select
+nmi_vector  = $FFFA         ; the RAM under the Kernal, when it's banked out
+
+; Command register values (see _sw_init).  Receive IRQs stay on in both, but
+; throttled raises RTS so the other end stops sending while the ring drains
+CMD_RECEIVE     = %00001001 ; RTS low, transmitter on, receiver IRQ on
+CMD_THROTTLE    = %00000001 ; RTS high, transmitter off, receiver IRQ on
+
+RING_HIGH_WATER = 224       ; raise RTS with this many bytes waiting, drop it
+                            ; again once _plat_net_update empties the ring
 
 .code
 
-; Start the ACIA with recv and xmit on, irq's off
+; Start the ACIA with recv and xmit on, and the receiver driving the NMI
 .proc _sw_init
     lda #0
     sta status              ; reset the SwiftLink (any write to status)
@@ -91,7 +103,20 @@ done_clear:
                             ;         :            11 = reserved for future expansions
     sta turbo232
 
-    lda #%00001011          ; Command Register Mask
+    sei                     ; install the NMI handler for both the Kernal
+    lda NMIVec              ; and the Kernal banked out (hires_draw, etc.)
+    sta old_nmi
+    lda NMIVec+1
+    sta old_nmi+1
+    lda #<nmi
+    sta NMIVec
+    sta nmi_vector
+    lda #>nmi
+    sta NMIVec+1
+    sta nmi_vector+1
+    cli
+
+    lda #CMD_RECEIVE        ; Command Register Mask
                             ; Bits 7-5: Parity: 000 = None  | 101 = Mark
                             ;         :         001 = Odd   | 111 = Space
                             ;         :         011 = Even  |
@@ -108,23 +133,70 @@ done_clear:
     rts
 .endproc
 
-; Called regularly from the "C" code to process the "network"
+; The ACIA raises an NMI for every byte received.  It goes into the ring,
+; even while the main loop is busy drawing, so nothing is lost in the ACIA's
+; one byte holding register.  The ring is 256 bytes so the indices just wrap
+.proc nmi
+    pha
+    txa
+    pha
+    lda 1                   ; hires_draw may have I/O banked out
+    pha
+    lda #$35                ; RAM, with I/O
+    sta 1
+
+    lda status              ; reading status also acknowledges the IRQ
+    and #%00001000
+    beq not_acia
+    lda data
+    ldx recv_head
+    inx
+    cpx recv_tail           ; full? (only if throttling didn't stop the
+    beq exit                ; other end) then the byte is dropped
+    dex
+    sta recv_ring,x
+    inx
+    stx recv_head
+
+    txa                     ; bytes waiting = head - tail
+    sec
+    sbc recv_tail
+    cmp #RING_HIGH_WATER
+    bcc exit
+    lda #CMD_THROTTLE       ; nearly full, raise RTS
+    sta command
+    sta throttled
+    bne exit                ; always
+
+not_acia:
+    lda CIA2_ICR            ; a CIA2 NMI holds the line low till its ICR is
+                            ; read, which would block the ACIA's.  RESTORE is
+                            ; an edge, and needs nothing - both are ignored
+exit:
+    pla
+    sta 1
+    pla
+    tax
+    pla
+    rti
+.endproc
+
+; Called regularly from the "C" code to process the "network".  The NMI
+; handler fills the ring, this only drains it into lines for _fics_tcp_recv
 .proc _plat_net_update
     ldy buffer_index        ; where to put the byte to be received
 read_byte:
-    lda status              ; see if there's a byte can be read
-    and #%00001000
-    beq idle_check          ; no, see about an idle timeout
-    lda data                ; receive the byte
+    ldx recv_tail           ; see if there's a byte in the ring
+    cpx recv_head
+    beq ring_empty          ; no, see about an idle timeout
+    lda recv_ring,x         ; receive the byte
+    inx
+    stx recv_tail
     sta receive_buffer,y    ; put it in the bank
     iny
     cmp #$20                ; Any char before ' ' is an eol for me
     bcc line_end
     cmp #$25                ; '%' (fics% also means end of line)
-    beq line_end
-    .repeat 4               ; Getting to status too fast means
-        nop                 ; nothing to receive and we exit the loop
-    .endrepeat              ; so spin a bit to get cadence right
     bne read_byte
 
 line_end:
@@ -147,6 +219,14 @@ line_ok:
     sty idle_counter+1
     jmp read_byte           ; and see if there's something more to receive
 
+ring_empty:
+    lda throttled           ; drained, so let the other end send again
+    beq idle_check
+    lda #0
+    sta throttled
+    lda #CMD_RECEIVE
+    sta command
+
 idle_check:
     sty buffer_index
     cpy #0                  ; received but not consumed?
@@ -165,6 +245,8 @@ send:
     ldy send_tail
     cpy send_head
     beq done                ; nothing to send
+    lda throttled           ; the transmitter is off while throttled
+    bne done
     lda status
     and #%00010000          ; Check if transmit is free
     beq done                ; Can't send so recv
@@ -194,7 +276,13 @@ length:
 
 ; Reset the SwiftLink (closes open connections)
 .proc _sw_shutdown
-    sta status             ; Reset the chip (any write)
+    sta status             ; Reset the chip (any write), which stops the IRQs
+    sei
+    lda old_nmi            ; and put the Kernal's NMI handler back
+    sta NMIVec
+    lda old_nmi+1
+    sta NMIVec+1
+    cli
     rts
 .endproc
 
@@ -208,6 +296,12 @@ buffer_index:   .byte $00   ; # bytes in bank, in the receive buffer
 ; Used to see if a buffer was received that didn't end in a \n
 idle_counter:   .byte $00, $00
 
+; NMI handler state.  The NMI owns recv_head, _plat_net_update owns recv_tail
+recv_head:      .byte $00
+recv_tail:      .byte $00
+throttled:      .byte $00   ; non-zero while RTS is raised
+old_nmi:        .word $0000
+
 ; Sender ring of 256 bytes
 send_head:      .byte $00
 send_tail:      .byte $00
@@ -218,3 +312,10 @@ send_buffer:    .res 256   ; Shared send buffer
 receive_buffer: .res 256
 text: .byte "stefan"
 data_end:
+
+.bss
+
+; Receive ring, filled by the NMI.  Page aligned so indexing never crosses
+; a page, which keeps the handler's timing fixed
+.align 256
+recv_ring:      .res 256
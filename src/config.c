@@ -0,0 +1,121 @@
+/*
+ *  config.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include <stdlib.h> // atoi
+#include <string.h>
+
+#include "global.h"
+
+// What's kept.  The cycle items are kept as their selection
+typedef struct _config {
+    uint8_t version;                // CONFIG_VERSION
+    uint8_t registered;
+    uint8_t auto_connect;
+    uint8_t game_type;
+    uint8_t wild_variant;
+    uint8_t rated;
+    uint8_t use_sought;
+    char user_name[MAX_FICS_UNAME_LEN];
+    char user_password[MAX_FICS_UNAME_LEN]; // Only with auto_connect
+    char server_name[MAX_FICS_SERVER_NAME_LEN];
+    char server_port_str[MAX_FICS_PORT_LEN];
+    char starting_time_srt[4 + 1];
+    char incremental_time_str[4 + 1];
+    char min_rating_str[4 + 1];
+    char max_rating_str[4 + 1];
+} config_t;
+
+static config_t config;
+
+/*-----------------------------------------------------------------------*/
+// Copy what was saved into a field of size bytes, which must end in a '\0'
+static void config_copy(char *dest, char *src, uint8_t size) {
+    src[size - 1] = '\0';
+    strcpy(dest, src);
+}
+
+/*-----------------------------------------------------------------------*/
+// Put the settings back, and leave the menus as their callbacks would have.
+// Nothing goes to the server, that's done going online
+void config_load(void) {
+    menu_item_t *login = ui_pregame_menu_options_menu.menu_items;
+    menu_item_t *settings = ui_settings_menu_items;
+    uint8_t selected;
+
+    if (!plat_core_config_load(&config, sizeof(config)) || config.version != CONFIG_VERSION) {
+        return;
+    }
+
+    config_copy(global.ui.user_name, config.user_name, sizeof(config.user_name));
+    config_copy(global.ui.user_password, config.user_password, sizeof(config.user_password));
+    config_copy(global.ui.server_name, config.server_name, sizeof(config.server_name));
+    config_copy(global.ui.server_port_str, config.server_port_str, sizeof(config.server_port_str));
+    global.ui.server_port = atoi(global.ui.server_port_str);
+    config_copy(global.setup.starting_time_srt, config.starting_time_srt, sizeof(config.starting_time_srt));
+    global.setup.starting_time = atoi(global.setup.starting_time_srt);
+    config_copy(global.setup.incremental_time_str, config.incremental_time_str, sizeof(config.incremental_time_str));
+    global.setup.incremental_time = atoi(global.setup.incremental_time_str);
+    config_copy(global.setup.min_rating_str, config.min_rating_str, sizeof(config.min_rating_str));
+    global.setup.min_rating = atoi(global.setup.min_rating_str);
+    config_copy(global.setup.max_rating_str, config.max_rating_str, sizeof(config.max_rating_str));
+    global.setup.max_rating = atoi(global.setup.max_rating_str);
+
+    selected = config.registered ? 1 : 0;
+    login[UI_LOGIN_OPTIONS_REGISTERED].selected = selected;
+    login[UI_LOGIN_OPTIONS_PASSWORD].item_state = MENU_STATE_HIDDEN - selected;
+    settings[UI_SETTINGS_RATED].item_state = MENU_STATE_HIDDEN - selected;
+    login[UI_LOGIN_OPTIONS_AUTO_CONNECT].selected = config.auto_connect ? 1 : 0;
+
+    selected = config.rated ? 1 : 0;
+    settings[UI_SETTINGS_RATED].selected = selected;
+    // 'r' 'u'
+    global.ui.my_rating_type[0] = selected ? '\x72' : '\x75';
+
+    if (config.game_type < GAME_TYPE_COUNT) {
+        settings[UI_SETTINGS_GAME_TYPE].selected = config.game_type;
+    }
+    if (config.wild_variant < settings[UI_SETTINGS_WILD_VARIANTS].num_selections) {
+        settings[UI_SETTINGS_WILD_VARIANTS].selected = config.wild_variant;
+    }
+    settings[UI_SETTINGS_WILD_VARIANTS].item_state = config.game_type == GAME_TYPE_WILD ? MENU_STATE_ENABLED : MENU_STATE_HIDDEN;
+
+    // Not using sought means seeking, with a time control
+    selected = config.use_sought ? 1 : 0;
+    settings[UI_SETTINGS_USE_SOUGHT].selected = selected;
+    global.setup.use_seek = !selected;
+    settings[UI_SETTINGS_START_TIME].item_state = MENU_STATE_ENABLED + selected;
+    settings[UI_SETTINGS_INCREMENTALTIME].item_state = MENU_STATE_ENABLED + selected;
+}
+
+/*-----------------------------------------------------------------------*/
+void config_save(void) {
+    menu_item_t *login = ui_pregame_menu_options_menu.menu_items;
+    menu_item_t *settings = ui_settings_menu_items;
+
+    memset(&config, 0, sizeof(config));
+    config.version = CONFIG_VERSION;
+    config.registered = login[UI_LOGIN_OPTIONS_REGISTERED].selected;
+    config.auto_connect = login[UI_LOGIN_OPTIONS_AUTO_CONNECT].selected;
+    config.game_type = settings[UI_SETTINGS_GAME_TYPE].selected;
+    config.wild_variant = settings[UI_SETTINGS_WILD_VARIANTS].selected;
+    config.rated = settings[UI_SETTINGS_RATED].selected;
+    config.use_sought = settings[UI_SETTINGS_USE_SOUGHT].selected;
+    strcpy(config.user_name, global.ui.user_name);
+    // Connecting on its own needs the password, otherwise it isn't kept
+    if (config.auto_connect) {
+        strcpy(config.user_password, global.ui.user_password);
+    }
+    strcpy(config.server_name, global.ui.server_name);
+    strcpy(config.server_port_str, global.ui.server_port_str);
+    strcpy(config.starting_time_srt, global.setup.starting_time_srt);
+    strcpy(config.incremental_time_str, global.setup.incremental_time_str);
+    strcpy(config.min_rating_str, global.setup.min_rating_str);
+    strcpy(config.max_rating_str, global.setup.max_rating_str);
+    plat_core_config_save(&config, sizeof(config));
+}
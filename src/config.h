@@ -0,0 +1,20 @@
+/*
+ *  config.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#ifndef _CONFIG_H_
+#define _CONFIG_H_
+
+// The settings are saved as a fixed layout, read back as is, so there's no
+// parsing.  A file of another version or size is ignored
+#define CONFIG_VERSION          1
+
+void config_load(void);
+void config_save(void);
+
+#endif // _CONFIG_H_
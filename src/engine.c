@@ -0,0 +1,526 @@
+/*
+ *  engine.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "global.h"
+
+#ifdef RETROMATE_ENGINE
+
+engine_t engine;
+
+// Zobrist keys, for the transposition table.  Pieces are (type - 1) * 2 +
+// side, and squares 0..63
+static uint64_t engine_piece_keys[12][64];
+static uint64_t engine_castle_keys[16];
+static uint64_t engine_ep_keys[8];
+static uint64_t engine_side_key;
+
+// Indexed by the piece enum
+static const int16_t engine_piece_value[7] = {0, 500, 320, 330, 900, 0, 100};
+// Closer to the middle by file, or rank, is better
+static const int8_t engine_centre[8] = {0, 1, 2, 3, 3, 2, 1, 0};
+
+// Below this much material, not counting pawns, kings come out
+#define ENGINE_ENDGAME          2600
+// Move ordering.  Quiet moves are 0, so the captures come first
+#define ENGINE_ORDER_TT         30000
+#define ENGINE_ORDER_CAPTURE    10000
+
+#define engine_key_square(sq)           (((sq) + ((sq) & 7)) >> 1)
+#define engine_key_piece(piece, sq)     engine_piece_keys[(((piece) & ~PIECE_WHITE) - 1) * 2 + MOVEGEN_SIDE(piece)][engine_key_square(sq)]
+
+/*-----------------------------------------------------------------------*/
+// Scored for the side to move
+static int16_t engine_evaluate(const position_t *p) {
+    int16_t score[2] = {0, 0};
+    int16_t material = 0;
+    uint8_t sq, piece, type, side, rank, ahead, centre;
+
+    for (sq = 0; sq < 0x78; sq++) {
+        if (MOVEGEN_OFF_BOARD(sq)) {
+            sq += 7;
+            continue;
+        }
+        piece = p->board[sq];
+        if (!piece) {
+            continue;
+        }
+        type = piece & ~PIECE_WHITE;
+        side = MOVEGEN_SIDE(piece);
+        rank = MOVEGEN_RANK(sq);
+        ahead = side ? rank : 7 - rank;
+        centre = engine_centre[MOVEGEN_FILE(sq)] + engine_centre[rank];
+        score[side] += engine_piece_value[type];
+        switch (type) {
+            case PAWN:
+                score[side] += (ahead - 1) * (ahead - 1) * 3 + engine_centre[MOVEGEN_FILE(sq)] * 4;
+                break;
+            case KNIGHT:
+                score[side] += centre * 6 - 12;
+                material += engine_piece_value[type];
+                break;
+            case BISHOP:
+                score[side] += centre * 4;
+                material += engine_piece_value[type];
+                break;
+            case ROOK:
+                score[side] += ahead == 6 ? 20 : 0;
+                material += engine_piece_value[type];
+                break;
+            case QUEEN:
+                score[side] += centre * 2;
+                material += engine_piece_value[type];
+                break;
+        }
+    }
+
+    // Kings hide till the pieces come off, then help
+    for (side = SIDE_BLACK; side <= SIDE_WHITE; side++) {
+        sq = p->king[side];
+        centre = engine_centre[MOVEGEN_FILE(sq)] + engine_centre[MOVEGEN_RANK(sq)];
+        score[side] += material > ENGINE_ENDGAME ? -centre * 8 : centre * 6;
+    }
+
+    if (p->side == SIDE_WHITE) {
+        return score[SIDE_WHITE] - score[SIDE_BLACK];
+    }
+    return score[SIDE_BLACK] - score[SIDE_WHITE];
+}
+
+/*-----------------------------------------------------------------------*/
+static uint64_t engine_key(const position_t *p) {
+    uint64_t key = engine_castle_keys[p->castle];
+    uint8_t sq;
+
+    for (sq = 0; sq < 0x78; sq++) {
+        if (MOVEGEN_OFF_BOARD(sq)) {
+            sq += 7;
+            continue;
+        }
+        if (p->board[sq]) {
+            key ^= engine_key_piece(p->board[sq], sq);
+        }
+    }
+    if (p->ep != MOVEGEN_NO_SQUARE) {
+        key ^= engine_ep_keys[MOVEGEN_FILE(p->ep)];
+    }
+    if (p->side == SIDE_WHITE) {
+        key ^= engine_side_key;
+    }
+    return key;
+}
+
+/*-----------------------------------------------------------------------*/
+// The key of p, just after movegen_make(p, m, u), from the key before
+static uint64_t engine_key_move(uint64_t key, const position_t *p, const move_t *m, const undo_t *u) {
+    uint8_t piece = p->board[m->to];
+    uint8_t rook;
+
+    key ^= engine_key_piece(piece, m->to);
+    if (m->promote) {
+        piece = PAWN | (piece & PIECE_WHITE);
+    }
+    key ^= engine_key_piece(piece, m->from);
+    if (u->captured) {
+        key ^= engine_key_piece(u->captured, m->to);
+    }
+    if (m->flags & MOVEGEN_EN_PASSANT) {
+        key ^= engine_key_piece(PAWN | (piece & PIECE_WHITE ? 0 : PIECE_WHITE), MOVEGEN_SQUARE(MOVEGEN_RANK(m->from), MOVEGEN_FILE(m->to)));
+    } else if (m->flags & MOVEGEN_CASTLE) {
+        rook = ROOK | (piece & PIECE_WHITE);
+        if (m->to > m->from) {
+            key ^= engine_key_piece(rook, m->from + 3) ^ engine_key_piece(rook, m->from + 1);
+        } else {
+            key ^= engine_key_piece(rook, m->from - 4) ^ engine_key_piece(rook, m->from - 1);
+        }
+    }
+    key ^= engine_castle_keys[u->castle] ^ engine_castle_keys[p->castle];
+    if (u->ep != MOVEGEN_NO_SQUARE) {
+        key ^= engine_ep_keys[MOVEGEN_FILE(u->ep)];
+    }
+    if (p->ep != MOVEGEN_NO_SQUARE) {
+        key ^= engine_ep_keys[MOVEGEN_FILE(p->ep)];
+    }
+    return key ^ engine_side_key;
+}
+
+/*-----------------------------------------------------------------------*/
+// The table move first, then the most valuable victim by the least valuable
+// attacker, then promotions, then the rest
+static void engine_order(uint8_t ply, uint8_t count, const move_t *tt_move) {
+    const move_t *m = engine.moves[ply];
+    int16_t *order = engine.order[ply];
+    uint8_t i;
+
+    for (i = 0; i < count; i++, m++) {
+        if (tt_move && m->from == tt_move->from && m->to == tt_move->to && m->promote == tt_move->promote) {
+            order[i] = ENGINE_ORDER_TT;
+        } else if (m->flags & MOVEGEN_CAPTURE) {
+            order[i] = ENGINE_ORDER_CAPTURE + engine_piece_value[engine.position.board[m->to] & ~PIECE_WHITE] * 8 -
+                       (engine.position.board[m->from] & ~PIECE_WHITE);
+        } else {
+            order[i] = m->promote ? engine_piece_value[m->promote] : 0;
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Swap the best of the moves from index on into index
+static void engine_pick(uint8_t ply, uint8_t count, uint8_t index) {
+    move_t *moves = engine.moves[ply];
+    int16_t *order = engine.order[ply];
+    uint8_t i, best = index;
+    move_t move;
+    int16_t score;
+
+    for (i = index + 1; i < count; i++) {
+        if (order[i] > order[best]) {
+            best = i;
+        }
+    }
+    if (best != index) {
+        move = moves[index];
+        moves[index] = moves[best];
+        moves[best] = move;
+        score = order[index];
+        order[index] = order[best];
+        order[best] = score;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Counts the node, and every ENGINE_POLL_NODES asks the platform whether to
+// stop.  Once stopped, every node returns straight away
+static bool engine_poll(void) {
+    if (!(++engine.nodes & (ENGINE_POLL_NODES - 1)) && !engine.aborted) {
+        engine.aborted = plat_core_engine_poll();
+    }
+    return engine.aborted;
+}
+
+/*-----------------------------------------------------------------------*/
+// Only captures and promotions, till the position is quiet
+static int16_t engine_quiesce(int16_t alpha, int16_t beta, uint8_t ply) {
+    position_t *p = &engine.position;
+    move_t *moves = engine.moves[ply];
+    uint8_t i, count;
+    int16_t score;
+    undo_t u;
+
+    if (engine_poll()) {
+        return 0;
+    }
+    score = engine_evaluate(p);
+    if (score >= beta || ply >= ENGINE_PLY_MAX - 1) {
+        return score;
+    }
+    if (score > alpha) {
+        alpha = score;
+    }
+
+    count = movegen_generate(p, moves);
+    engine_order(ply, count, NULL);
+    for (i = 0; i < count; i++) {
+        engine_pick(ply, count, i);
+        if (engine.order[ply][i] <= 0) {
+            break;
+        }
+        if (!movegen_make(p, &moves[i], &u)) {
+            continue;
+        }
+        score = -engine_quiesce(-beta, -alpha, ply + 1);
+        movegen_unmake(p, &moves[i], &u);
+        if (engine.aborted) {
+            return 0;
+        }
+        if (score > alpha) {
+            if (score >= beta) {
+                return score;
+            }
+            alpha = score;
+        }
+    }
+    return alpha;
+}
+
+/*-----------------------------------------------------------------------*/
+// Mate scores are kept in the table as distance from the node, not the root
+static int16_t engine_tt_score(int16_t score, int8_t ply) {
+    if (score >= ENGINE_MATE - ENGINE_PLY_MAX) {
+        return score + ply;
+    }
+    if (score <= -ENGINE_MATE + ENGINE_PLY_MAX) {
+        return score - ply;
+    }
+    return score;
+}
+
+/*-----------------------------------------------------------------------*/
+static int16_t engine_alphabeta(int16_t alpha, int16_t beta, int8_t depth, uint8_t ply) {
+    position_t *p = &engine.position;
+    move_t *moves = engine.moves[ply];
+    engine_entry_t *entry;
+    move_t tt_move, best_move;
+    uint64_t key = engine.key;
+    int16_t score, best = -ENGINE_INFINITY;
+    uint8_t i, count, legal = 0;
+    uint8_t bound = ENGINE_BOUND_UPPER;
+    bool has_tt_move = false;
+    bool check;
+    undo_t u;
+
+    engine.pv_length[ply] = ply;
+    if (engine_poll()) {
+        return 0;
+    }
+    if (ply >= ENGINE_PLY_MAX - 1) {
+        return engine_evaluate(p);
+    }
+
+    // Look one deeper when in check, so there's always a way out seen
+    check = movegen_in_check(p);
+    if (check) {
+        depth++;
+    }
+    if (depth <= 0) {
+        return engine_quiesce(alpha, beta, ply);
+    }
+
+    entry = &engine.tt[key & (ENGINE_TT_ENTRIES - 1)];
+    if (entry->key == key) {
+        tt_move = entry->move;
+        has_tt_move = true;
+        // Not at the root, which has to come back with a move
+        if (ply && entry->depth >= depth) {
+            score = engine_tt_score(entry->score, -ply);
+            if (entry->bound == ENGINE_BOUND_EXACT ||
+                    (entry->bound == ENGINE_BOUND_LOWER && score >= beta) ||
+                    (entry->bound == ENGINE_BOUND_UPPER && score <= alpha)) {
+                return score;
+            }
+        }
+    }
+
+    count = movegen_generate(p, moves);
+    engine_order(ply, count, has_tt_move ? &tt_move : NULL);
+    for (i = 0; i < count; i++) {
+        engine_pick(ply, count, i);
+        if (!movegen_make(p, &moves[i], &u)) {
+            continue;
+        }
+        engine.key = engine_key_move(key, p, &moves[i], &u);
+        legal++;
+        score = -engine_alphabeta(-beta, -alpha, depth - 1, ply + 1);
+        movegen_unmake(p, &moves[i], &u);
+        engine.key = key;
+        if (engine.aborted) {
+            return 0;
+        }
+        if (score > best) {
+            best = score;
+            best_move = moves[i];
+            if (score > alpha) {
+                alpha = score;
+                bound = ENGINE_BOUND_EXACT;
+                engine.pv[ply][ply] = moves[i];
+                memcpy(&engine.pv[ply][ply + 1], &engine.pv[ply + 1][ply + 1], (engine.pv_length[ply + 1] - ply - 1) * sizeof(move_t));
+                engine.pv_length[ply] = MAX(engine.pv_length[ply + 1], ply + 1);
+                if (score >= beta) {
+                    bound = ENGINE_BOUND_LOWER;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (!legal) {
+        return check ? -ENGINE_MATE + ply : 0;
+    }
+
+    // Always replace - the newest search knows the most
+    entry->key = key;
+    entry->move = best_move;
+    entry->score = engine_tt_score(best, ply);
+    entry->depth = depth;
+    entry->bound = bound;
+    return best;
+}
+
+/*-----------------------------------------------------------------------*/
+static uint64_t engine_random(uint64_t *state) {
+    // splitmix64
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/*-----------------------------------------------------------------------*/
+// The eval on the first row, then as much of the best line as fits
+static void engine_show(const engine_result_t *result) {
+    char line[ENGINE_PV_MAX * 6 + 1];
+    int16_t score = result->score;
+    uint8_t i, len;
+
+    log_clear(&engine.panel);
+    if (!result->pv_length) {
+        len = snprintf(line, sizeof(line), score ? "Checkmate" : "Stalemate");
+    } else if (abs(score) >= ENGINE_MATE - ENGINE_PLY_MAX) {
+        // In moves, not plies
+        len = snprintf(line, sizeof(line), "Mate %+d d%u",
+                       score > 0 ? (ENGINE_MATE - score + 1) / 2 : -((ENGINE_MATE + score + 1) / 2), (unsigned)result->depth);
+    } else {
+        len = snprintf(line, sizeof(line), "Eval %+d.%02d d%u", score / 100, abs(score) % 100, (unsigned)result->depth);
+        if (score < 0 && score > -100) {
+            // %+d of 0 is +0
+            line[5] = '\x2d';       // '-'
+        }
+    }
+    log_add_line(&engine.panel, line, len);
+
+    len = 0;
+    for (i = 0; i < result->pv_length && engine.panel.size < ENGINE_PANEL_ROWS; i++) {
+        if (len && len + 6 > engine.panel.cols) {
+            log_add_line(&engine.panel, line, len);
+            len = 0;
+            if (engine.panel.size == ENGINE_PANEL_ROWS) {
+                break;
+            }
+        }
+        if (len) {
+            line[len++] = '\x20';   // ' '
+        }
+        len += movegen_move_text(&result->pv[i], line + len);
+    }
+    if (len) {
+        log_add_line(&engine.panel, line, len);
+    }
+    // Blank what the last result showed below this one
+    while (engine.panel.size < ENGINE_PANEL_ROWS) {
+        log_add_line(&engine.panel, "\x0a", 1);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Stop the search and blank the panel
+void engine_clear(void) {
+    if (!engine.running) {
+        return;
+    }
+    plat_core_engine_stop();
+    engine.running = false;
+    log_clear(&engine.panel);
+    while (engine.panel.size < ENGINE_PANEL_ROWS) {
+        log_add_line(&engine.panel, "\x0a", 1);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Show the newest result, if there is one.  Main thread
+void engine_draw_update(void) {
+    engine_result_t result;
+
+    if (engine.running && plat_core_engine_result(&result)) {
+        engine_show(&result);
+    }
+    if (engine.panel.modified) {
+        plat_draw_log(&engine.panel, plat_core_get_status_x(), plat_core_get_rows() - ENGINE_PANEL_ROWS, true);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+void engine_init(void) {
+    uint64_t state = 0x5245544D41544521ULL;
+    uint8_t i, j;
+
+    for (i = 0; i < 12; i++) {
+        for (j = 0; j < 64; j++) {
+            engine_piece_keys[i][j] = engine_random(&state);
+        }
+    }
+    for (i = 0; i < 16; i++) {
+        engine_castle_keys[i] = engine_random(&state);
+    }
+    engine_castle_keys[0] = 0;
+    for (i = 0; i < 8; i++) {
+        engine_ep_keys[i] = engine_random(&state);
+    }
+    engine_side_key = engine_random(&state);
+
+    engine.tt = calloc(ENGINE_TT_ENTRIES, sizeof(engine_entry_t));
+    if (!engine.tt) {
+        plat_core_exit();
+    }
+    log_init(&engine.panel, global.view.info_panel.cols, ENGINE_PANEL_ROWS);
+    engine.panel.clip = true;
+}
+
+/*-----------------------------------------------------------------------*/
+// Give the platform the position style 12 just brought in.  No engine helps
+// in a game being played, so that stops the search instead, and does so as
+// the first board of the game arrives
+void engine_position(void) {
+    position_t p;
+
+    if (global.state.game_active && global.state.includes_me) {
+        engine_clear();
+        return;
+    }
+
+    if (!movegen_set_frame(&p, global.state.chess_board, &global.frame)) {
+        // Nothing to search on a board with no king, say
+        engine_clear();
+        return;
+    }
+    plat_core_engine_start(&p);
+    engine.running = true;
+}
+
+/*-----------------------------------------------------------------------*/
+// Iterative deepening, till the platform says stop.  Each depth that
+// completes is published.  Search thread
+void engine_search(const position_t *root) {
+    engine_result_t result;
+    uint8_t depth;
+    int16_t score;
+
+    engine.position = *root;
+    engine.key = engine_key(root);
+    engine.nodes = 0;
+    engine.aborted = false;
+
+    for (depth = 1; depth <= ENGINE_DEPTH_MAX; depth++) {
+        score = engine_alphabeta(-ENGINE_INFINITY, ENGINE_INFINITY, depth, 0);
+        if (engine.aborted) {
+            break;
+        }
+        result.nodes = engine.nodes;
+        result.depth = depth;
+        result.score = root->side == SIDE_WHITE ? score : -score;
+        result.pv_length = MIN(engine.pv_length[0], ENGINE_PV_MAX);
+        memcpy(result.pv, engine.pv[0], result.pv_length * sizeof(move_t));
+        plat_core_engine_publish(&result);
+        // Nothing to play, or a mate found, won't change with more depth
+        if (!result.pv_length || abs(score) >= ENGINE_MATE - ENGINE_PLY_MAX) {
+            break;
+        }
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+void engine_shutdown(void) {
+    free(engine.tt);
+    engine.tt = NULL;
+    log_shutdown(&engine.panel);
+}
+
+#endif // RETROMATE_ENGINE
@@ -0,0 +1,80 @@
+/*
+ *  engine.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#ifndef _ENGINE_H_
+#define _ENGINE_H_
+
+#ifdef RETROMATE_ENGINE
+
+// The platform runs engine_search on its own thread.  It stops a search when
+// a new position comes, or after this long on the one position
+#define ENGINE_TIME_BUDGET_MS   10000
+#define ENGINE_DEPTH_MAX        32
+#define ENGINE_PLY_MAX          64      // Depth, extensions and captures
+#define ENGINE_PV_MAX           8
+#define ENGINE_TT_ENTRIES       (1UL << 20)     // A power of 2, 16 bytes each
+#define ENGINE_POLL_NODES       1024    // Nodes between plat_core_engine_poll calls
+#define ENGINE_MATE             30000
+#define ENGINE_INFINITY         32000
+// The panel is the bottom rows of the info panel
+#define ENGINE_PANEL_ROWS       4
+
+// ENGINE_BOUND_*, what an engine_entry_t score is
+enum {
+    ENGINE_BOUND_EXACT,
+    ENGINE_BOUND_LOWER,             // Failed high, the score is at least this
+    ENGINE_BOUND_UPPER,             // Failed low, the score is at most this
+};
+
+// A search result, after each depth completes
+typedef struct _engine_result {
+    uint32_t nodes;
+    uint8_t depth;
+    int16_t score;                  // Centipawns, for white
+    uint8_t pv_length;
+    move_t pv[ENGINE_PV_MAX];
+} engine_result_t;
+
+// Transposition table entry
+typedef struct _engine_entry {
+    uint64_t key;
+    move_t move;
+    int16_t score;
+    uint8_t depth;
+    uint8_t bound;                  // ENGINE_BOUND_*
+} engine_entry_t;
+
+typedef struct _engine {
+    // Used only by the search thread
+    position_t position;
+    uint64_t key;
+    uint32_t nodes;
+    bool aborted;                   // plat_core_engine_poll said to stop
+    engine_entry_t *tt;
+    uint8_t pv_length[ENGINE_PLY_MAX];
+    move_t pv[ENGINE_PLY_MAX][ENGINE_PLY_MAX];
+    move_t moves[ENGINE_PLY_MAX][MOVEGEN_MAX_MOVES];
+    int16_t order[ENGINE_PLY_MAX][MOVEGEN_MAX_MOVES];   // Move ordering scores
+    // Used only by the main thread
+    tLog panel;
+    bool running;                   // A position was given to the platform
+} engine_t;
+
+extern engine_t engine;
+
+void engine_clear(void);
+void engine_draw_update(void);
+void engine_init(void);
+void engine_position(void);
+void engine_search(const position_t *root);
+void engine_shutdown(void);
+
+#endif // RETROMATE_ENGINE
+
+#endif // _ENGINE_H_
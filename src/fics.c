@@ -55,23 +55,66 @@
 #define FICS_CMD_REFRESH            "refresh"
 #define FICS_CMD_S12REFRESH         "set style 12\nrefresh"
 #define FICS_CMD_SOUGHT             "sought"
+#define FICS_CMD_GAMES              "games"
+
+// Table parsing
+                                    // "displayed"
+#define FICS_TABLE_DISPLAYED        "\x64\x69\x73\x70\x6c\x61\x79\x65\x64"
+                                    // "["
+#define FICS_TABLE_OPEN_BRACKET     "\x5b"
+                                    // "[]"
+#define FICS_TABLE_BRACKETS         "\x5b\x5d"
+
+#define FICS_COLUMN(kind, type, field, accept)  { kind, offsetof(type, field), sizeof(((type *)0)->field), accept }
+#define FICS_COLUMN_SKIP                        { FICS_COL_SKIP, 0, 0, NULL }
+
+fics_data_t fics_data;
+
+static const fics_column_t fics_columns_sought[] = {
+    FICS_COLUMN(FICS_COL_STR, fics_sought_t, game_number, NULL),
+    FICS_COLUMN(FICS_COL_INT, fics_sought_t, rating, NULL),
+    FICS_COLUMN(FICS_COL_STR, fics_sought_t, user_name, NULL),
+    FICS_COLUMN(FICS_COL_INT, fics_sought_t, start_time, NULL),
+    FICS_COLUMN(FICS_COL_INT, fics_sought_t, inc_time, NULL),
+    FICS_COLUMN(FICS_COL_STR, fics_sought_t, rated, NULL),
+    FICS_COLUMN(FICS_COL_STR, fics_sought_t, game_type, NULL),
+    FICS_COLUMN(FICS_COL_STR | FICS_COL_OPTIONAL, fics_sought_t, start_color, FICS_TABLE_OPEN_BRACKET),
+    FICS_COLUMN(FICS_COL_STR, fics_sought_t, range, NULL),
+};
+
+static const fics_column_t fics_columns_games[] = {
+    FICS_COLUMN(FICS_COL_INT, fics_game_t, game_number, NULL),
+    FICS_COLUMN(FICS_COL_INT, fics_game_t, w_rating, NULL),
+    FICS_COLUMN(FICS_COL_STR, fics_game_t, w_name, NULL),
+    FICS_COLUMN(FICS_COL_INT, fics_game_t, b_rating, NULL),
+    FICS_COLUMN(FICS_COL_STR, fics_game_t, b_name, NULL),
+    FICS_COLUMN_SKIP,                                           // [
+    FICS_COLUMN(FICS_COL_STR, fics_game_t, game_type, NULL),
+    FICS_COLUMN(FICS_COL_INT, fics_game_t, initial_time, NULL),
+    FICS_COLUMN(FICS_COL_INT, fics_game_t, time_increment, NULL),
+    FICS_COLUMN_SKIP,                                           // ]
+    FICS_COLUMN(FICS_COL_STR, fics_game_t, w_clock, NULL),
+    FICS_COLUMN_SKIP,                                           // -
+    FICS_COLUMN(FICS_COL_STR, fics_game_t, b_clock, NULL),
+    FICS_COLUMN_SKIP,                                           // (strength)
+    FICS_COLUMN(FICS_COL_STR, fics_game_t, color_to_move, NULL),
+    FICS_COLUMN(FICS_COL_INT, fics_game_t, move_number, NULL),
+};
 
-enum {
-    FS_STATUS_OKAY,
-    FS_STATUS_NEXTLINE,
-    FS_STATUS_DONE,
-    FS_STATUS_NO_MATCH,
-    FS_STATUS_ERROR,
+const fics_schema_t fics_schema_sought = {
+    FICS_CMD_SOUGHT,                                            // command
+    fics_columns_sought,                                        // columns
+    sizeof(fics_columns_sought) / sizeof(fics_column_t),        // num_columns
+    "",                                                         // breaks
+    FICS_TABLE_DISPLAYED,                                       // end_word
 };
 
-fics_data_t fics_data = {
-    SOUGHT_GAME_NUM,
-    FS_STATUS_OKAY,
-    0,
-    0,
-    {},
-    {},
-    ""
+const fics_schema_t fics_schema_games = {
+    FICS_CMD_GAMES,                                             // command
+    fics_columns_games,                                         // columns
+    sizeof(fics_columns_games) / sizeof(fics_column_t),         // num_columns
+    FICS_TABLE_BRACKETS,                                        // breaks
+    FICS_TABLE_DISPLAYED,                                       // end_word
 };
 
 // Forward declare
@@ -198,41 +241,97 @@ bool fics_isspace(char c) {
 #endif
 
 /*-----------------------------------------------------------------------*/
-static void fics_next_number() {
-    // Skip whitespace
-    while(fics_data.length && fics_isspace(*fics_data.parse_point)) {
-        fics_data.length--;
-        fics_data.parse_point++;
+// Like atoi, but a rating of "++++" or "----" is just 0
+static int16_t fics_token_number(const char *token) {
+    int16_t value = 0;
+    while (*token == '\x2b' || *token == '\x2d') { // '+' '-'
+        token++;
+    }
+    while (*token >= '\x30' && *token <= '\x39') {
+        value = value * 10 + (*token++ - '\x30');
+    }
+    return value;
+}
+
+/*-----------------------------------------------------------------------*/
+// A row is complete when all columns are filled
+static void fics_table_row_end(void) {
+    fics_table_t *table = &fics_data.table;
+    if (!table->skip_line && table->column == table->schema->num_columns) {
+        table->row_callback(&fics_data.record, table->extra);
+    }
+    table->column = 0;
+    table->extra = 0;
+}
+
+/*-----------------------------------------------------------------------*/
+// Put a complete token in its column
+static void fics_table_token(void) {
+    fics_table_t *table = &fics_data.table;
+    const fics_schema_t *schema = table->schema;
+    const fics_column_t *column;
+    char *field;
+    uint8_t len;
+
+    table->tok[table->tok_len] = '\0';
+    table->tok_len = 0;
+
+    // The summary, "  3 ads displayed.", doesn't fit the schema, so the end
+    // word is only looked for on a line being skipped, or at the start of a
+    // line.  Never in a row, where it could be a user name
+    if (table->skip_line || !table->column) {
+        len = strlen(schema->end_word);
+        if (0 == strncmp(table->tok, schema->end_word, len) && (!table->tok[len] || table->tok[len] == '\x2e')) { // '.'
+            table->done = true;
+            return;
+        }
     }
 
-    // If there's nothing more, done
-    if(!fics_data.length) {
+    if (table->skip_line) {
         return;
     }
 
-    // If not a number, mark as such
-    if(!fics_isnumeric(*fics_data.parse_point)) {
-        fics_data.sought_word[fics_data.parse_state] = '\0';
-        fics_data.sought_word_len[fics_data.parse_state] = 0;
-        fics_data.parse_state++;
+    if (table->column == schema->num_columns) {
+        if (table->extra < 255) {
+            table->extra++;
+        }
+        return;
     }
 
-    // Extract the number
-    fics_data.sought_word[fics_data.parse_state] = fics_data.parse_point;
-    while(fics_data.length && fics_isnumeric(*fics_data.parse_point)) {
-            fics_data.length--;
-            fics_data.parse_point++;
+    while (1) {
+        column = &schema->columns[table->column];
+        field = (char *)&fics_data.record + column->offset;
+        if (!(column->kind & FICS_COL_OPTIONAL) || strchr(column->accept, table->tok[0])) {
+            break;
+        }
+        // Not this optional column, so leave it empty and try the next
+        if ((column->kind & ~FICS_COL_OPTIONAL) == FICS_COL_INT) {
+            *(int16_t *)field = 0;
+        } else {
+            *field = '\0';
+        }
+        if (++table->column == schema->num_columns) {
+            table->extra++;
+            return;
+        }
     }
 
-    if(fics_data.length) {
-        // Set up the length
-        fics_data.sought_word_len[fics_data.parse_state] = fics_data.parse_point - fics_data.sought_word[fics_data.parse_state];
-        fics_data.parse_state++;
-    } else {
-        // This is a serious issue - this record is split - I don't really deal with that
-        // So skip till a newline and this record will just be ignored
-        fics_data.status = FS_STATUS_NEXTLINE;
+    switch (column->kind & ~FICS_COL_OPTIONAL) {
+        case FICS_COL_INT:
+            if (!fics_isnumeric(table->tok[0])) {
+                // Headers, summaries, etc.
+                table->skip_line = true;
+                return;
+            }
+            *(int16_t *)field = fics_token_number(table->tok);
+        break;
+
+        case FICS_COL_STR:
+            strncpy(field, table->tok, column->size - 1);
+            field[column->size - 1] = '\0';
+        break;
     }
+    table->column++;
 }
 
 #ifdef __ATARIXL__
@@ -240,41 +339,34 @@ static void fics_next_number() {
 #endif
 
 /*-----------------------------------------------------------------------*/
-static void fics_next_word() {
-    // Skip whitespace
-    while(fics_data.length && fics_isspace(*fics_data.parse_point)) {
-        fics_data.length--;
-        fics_data.parse_point++;
-    }
-
-    // If there's nothing more, done
-    if(!fics_data.length) {
-        return;
-    }
-
-    // If not a word-start, mark as such
-    if(!*fics_data.parse_point) {
-        fics_data.sought_word[fics_data.parse_state] = '\0';
-        fics_data.sought_word_len[fics_data.parse_state] = 0;
-        fics_data.parse_state++;
-    }
-
-    // Extract the word
-    fics_data.sought_word[fics_data.parse_state] = fics_data.parse_point;
-    while(fics_data.length && *fics_data.parse_point && !fics_isspace(*fics_data.parse_point)) {
-            fics_data.length--;
-            fics_data.parse_point++;
-    }
+// Run buf through the tokenizer.  Returns how much of buf was used, which is
+// less than len only if the end of the table was found
+static int fics_table_feed(const char *buf, int len) {
+    fics_table_t *table = &fics_data.table;
+    const char *breaks = table->schema->breaks;
+    const char *parse_point = buf;
 
-    if(fics_data.length) {
-        // set the length
-        fics_data.sought_word_len[fics_data.parse_state] = fics_data.parse_point - fics_data.sought_word[fics_data.parse_state];
-        fics_data.parse_state++;
-    } else {
-        // This is a serious issue - this record is split - I don't really deal with that
-        // So skip till a newline and this record will just be ignored
-        fics_data.status = FS_STATUS_NEXTLINE;
+    while (len-- && !table->done) {
+        char character = *parse_point++;
+        if (fics_isspace(character)) {
+            if (table->tok_len) {
+                fics_table_token();
+            }
+            if (character == '\x0a') { // '\n'
+                fics_table_row_end();
+                table->skip_line = false;
+            }
+        } else if (character && strchr(breaks, character)) {
+            if (table->tok_len) {
+                fics_table_token();
+            }
+            table->tok[table->tok_len++] = character;
+            fics_table_token();
+        } else if (table->tok_len < FICS_TOKEN_MAX) {
+            table->tok[table->tok_len++] = character;
+        }
     }
+    return parse_point - buf;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -383,147 +475,58 @@ static void fics_ndcb_login_flow(const char *buf, int len) {
 }
 
 /*-----------------------------------------------------------------------*/
-static void fics_ndcb_sought_list(const char *buf, int len) {
-    if(fics_data.status == FS_STATUS_NEXTLINE) {
-        while(len && '\x0a' != *buf) {  // '\n'
-            len--;
-            buf++;
-        }
-        fics_data.parse_state = SOUGHT_GAME_NUM;
-    }
-    fics_data.status = FS_STATUS_OKAY;
-    fics_data.parse_point = buf;
-    fics_data.length = len;
-
-    while(fics_data.status == FS_STATUS_OKAY && fics_data.length) {
-        switch(fics_data.parse_state) {
-            case SOUGHT_GAME_NUM:
-                fics_next_number();
-                break;
-
-            case SOUGHT_RANKING:
-                fics_next_number();
-                if(!fics_data.sought_word_len[SOUGHT_RANKING]) {
-                    if(fics_data.game_number_str[0]) {
-                        fics_data.status = FS_STATUS_DONE;
-                    } else {
-                        fics_data.status = FS_STATUS_NO_MATCH;
-                    }
-                }
-            break;
-
-            case SOUGHT_USER_NAME:
-                fics_next_word();
-            break;
-
-            case SOUGHT_START_TIME:
-                fics_next_number();
-            break;
-
-            case SOUGHT_INC_TIME:
-                fics_next_number();
-            break;
-
-            case SOUGHT_RATED:
-                fics_next_word();
-            break;
-
-            case SOUGHT_GAME_TYPE:
-                fics_next_word();
-            break;
-
-            case SOUGHT_START_COLOR:
-                fics_next_word();
-                if(fics_data.sought_word_len[SOUGHT_START_COLOR] > 0) {
-                    if(*fics_data.sought_word[SOUGHT_START_COLOR] != '\x5b') { // '['
-                        // If the start color isn't a color but is actually the range
-                        fics_data.sought_word[SOUGHT_RANGE] = fics_data.sought_word[SOUGHT_START_COLOR];
-                        fics_data.sought_word_len[SOUGHT_RANGE] = fics_data.sought_word_len[SOUGHT_START_COLOR];
-                        fics_data.sought_word_len[SOUGHT_START_COLOR] = 0;
-                        // Go to post range (extra)
-                        fics_data.parse_state++;
-                    }
-                }
-            break;
-
-            case SOUGHT_RANGE:
-                fics_next_number();
-            break;
+static void fics_rcb_sought(const void *record, uint8_t extra) {
+    const fics_sought_t *sought = (const fics_sought_t *)record;
+    uint16_t delta;
 
-            case SOUGHT_EXTRA:
-                // Start by saying there's no extra
-                fics_data.sought_word_len[SOUGHT_EXTRA] = 0;
-                // see if the end of the line is here
-                while(fics_data.length) {
-                    while(*fics_data.parse_point != '\x0a' && fics_isspace(*fics_data.parse_point)) {
-                        fics_data.length--;
-                        fics_data.parse_point++;
-                    }
-                    // If not EOL, there's some extra info to skip
-                    if(*fics_data.parse_point != '\x0a') {
-                        fics_next_word();
-                        // keep at extra
-                        fics_data.parse_state = SOUGHT_EXTRA;
-                    } else {
-                        uint16_t rating, delta;
-
-                        // Reset for the next line
-                        fics_data.parse_state = SOUGHT_GAME_NUM;
-
-                        // See if this is a fitting game
-
-                        // Don't pick a game with a color preference
-                        if (fics_data.sought_word_len[SOUGHT_START_COLOR]) {
-                            break;
-                        }
-                        // Make sure there are no strings attached
-                        if (fics_data.sought_word_len[SOUGHT_EXTRA]) {
-                            break;
-                        }
-
-                        // Make sure it's the type of game I want
-                        if (global.ui.my_game_type && 0 != strncmp(global.ui.my_game_type, fics_data.sought_word[SOUGHT_GAME_TYPE], fics_data.sought_word_len[SOUGHT_GAME_TYPE])) {
-                            break;
-                        }
-
-                        // Make sure it's rated or unrated as I desire
-                        if (global.ui.my_rating_type[0] != fics_data.sought_word[SOUGHT_RATED][0]) {
-                            break;
-                        }
-
-                        // See if this offer is closer to my rating
-                        rating = atoi(fics_data.sought_word[SOUGHT_RANKING]);
-                        delta = abs(rating - global.ui.my_rating);
-                        if (delta < fics_data.rating_delta && fics_data.sought_word_len[SOUGHT_GAME_NUM] < sizeof(fics_data.game_number_str) - 1) {
-                            fics_data.rating_delta = delta;
-                            strncpy(fics_data.game_number_str, fics_data.sought_word[SOUGHT_GAME_NUM], fics_data.sought_word_len[SOUGHT_GAME_NUM]);
-                            fics_data.game_number_str[fics_data.sought_word_len[SOUGHT_GAME_NUM]] = '\0';
-                        }
-                        break;
-                    }
-                }
-            break;
-        }
+    // Don't pick a game with a color preference
+    if (sought->start_color[0]) {
+        return;
     }
+    // Make sure there are no strings attached
+    if (extra) {
+        return;
+    }
+    // Make sure it's the type of game I want
+    if (global.ui.my_game_type && 0 != strncmp(global.ui.my_game_type, sought->game_type, strlen(sought->game_type))) {
+        return;
+    }
+    // Make sure it's rated or unrated as I desire
+    if (global.ui.my_rating_type[0] != sought->rated[0]) {
+        return;
+    }
+    // See if this offer is closer to my rating
+    delta = abs(sought->rating - global.ui.my_rating);
+    if (delta < fics_data.rating_delta) {
+        fics_data.rating_delta = delta;
+        strcpy(fics_data.game_number_str, sought->game_number);
+    }
+}
 
-    switch(fics_data.status) {
-        case FS_STATUS_DONE:
-            fics_set_new_data_callback(fics_ndcb_update_from_server);
-            strcpy(global.view.scratch_buffer, FICS_CMD_PLAY);
-            strcat(global.view.scratch_buffer, fics_data.game_number_str);
-            plat_net_send(global.view.scratch_buffer);
-            // Asking for the game - may not start though so re-enable the menu
-            ui_in_game_menu.menu_items[UI_MENU_INGAME_NEW].item_state = MENU_STATE_ENABLED;
-        break;
-
-        case FS_STATUS_NO_MATCH:
-        case FS_STATUS_ERROR:
-            fics_set_new_data_callback(fics_ndcb_update_from_server);
-            fics_play(true);
-        break;
+/*-----------------------------------------------------------------------*/
+static void fics_tdcb_sought(void) {
+    if (fics_data.game_number_str[0]) {
+        strcpy(global.view.scratch_buffer, FICS_CMD_PLAY);
+        strcat(global.view.scratch_buffer, fics_data.game_number_str);
+        plat_net_send(global.view.scratch_buffer);
+        // Asking for the game - may not start though so re-enable the menu
+        menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_NEW, MENU_STATE_ENABLED);
+    } else {
+        // Nothing suitable, so seek instead
+        fics_play(true);
+    }
+}
 
-        default:
-        break;
+/*-----------------------------------------------------------------------*/
+static void fics_ndcb_table(const char *buf, int len) {
+    int used = fics_table_feed(buf, len);
+    if (fics_data.table.done) {
+        // Back to regular processing, including what followed the table
+        fics_set_new_data_callback(fics_ndcb_update_from_server);
+        fics_data.table.done_callback();
+        if (used < len && global.fics.new_data_callback == fics_ndcb_update_from_server) {
+            fics_ndcb_update_from_server(buf + used, len - used);
+        }
     }
 }
 
@@ -537,6 +540,11 @@ static void fics_ndcb_update_from_server(const char *buf, int len) {
             // In a style 12 game
             uint8_t i;
             char *cb = global.state.chess_board;
+            zobrist_key_t key;
+            bool my_side = global.state.my_side;
+            bool changed = true;
+            char game_number[sizeof(global.frame.game_number)];
+            key = zobrist.key;
             parse_start = parse_point;
             global.state.game_active = true;
             parse_point += 5;
@@ -547,12 +555,27 @@ static void fics_ndcb_update_from_server(const char *buf, int len) {
                 plat_net_send(FICS_CMD_REFRESH);
                 return;
             }
-            global.view.refresh = true;
-            for (i = 0; i < 8; i++) {
-                strncpy(cb, parse_point, 8);
-                cb += 8;
-                parse_point += 9;
+            PERF_COUNT(PERF_STYLE12_FRAMES, 1);
+            PERF_SPAN_BEGIN(PERF_SPAN_STYLE12);
+#ifndef RETROMATE_ARCHIVE
+            // A stepped back board is brought up to date first
+            review_begin();
+#endif
+            // Only the squares that changed go into the key
+            for (i = 0; i < 64; i++) {
+                if (cb[i] != *parse_point) {
+                    zobrist_square(i, cb[i], *parse_point);
+#ifndef RETROMATE_ARCHIVE
+                    review_square(i, cb[i], *parse_point);
+#endif
+                    cb[i] = *parse_point;
+                }
+                if ((i & 7) == 7) {
+                    parse_point++;          // Skip the ' ' after a row
+                }
+                parse_point++;
             }
+            strcpy(game_number, global.frame.game_number);
             parse_point = fics_copy_data(global.frame.color_to_move, parse_point, 1);
             parse_point = fics_copy_data(global.frame.double_pawn_push, parse_point, 2);
             parse_point = fics_copy_data(global.frame.w_can_castle_l, parse_point, 1);
@@ -587,17 +610,40 @@ static void fics_ndcb_update_from_server(const char *buf, int len) {
                     global.state.cursor = global.state.my_side ? 51 : 12;
                 }
             }
+
+            // A refresh, or the server saying it again while observing, sends
+            // the position on show.  Then only the info panel changes
+            zobrist_flags();
+            if (strcmp(game_number, global.frame.game_number)) {
+                zobrist_history_clear();
+#ifndef RETROMATE_ARCHIVE
+                review_clear();
+#endif
+            } else if (my_side == global.state.my_side && ZOBRIST_SAME(key, zobrist.key)) {
+                changed = false;
+            }
+            if (changed) {
+                // Only a board that will be drawn starts the move span
+                PERF_MOVE(PERF_MOVE_PARSED);
+                global.view.refresh = true;
+                zobrist.repeats = zobrist_repetitions(MIN(atoi(global.frame.moves_since_irreversible), 255));
+            } else {
+                PERF_COUNT(PERF_STYLE12_UNCHANGED, 1);
+            }
+            // Threefold repetition is a draw the player to move may claim
+            menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_DRAW,
+                            global.state.my_move && zobrist.repeats >= 3 ? MENU_STATE_ENABLED : MENU_STATE_HIDDEN);
             if (ui_in_game_menu.menu_items[UI_MENU_INGAME_NEW].item_state == MENU_STATE_ENABLED ||
                     ui_in_game_menu.menu_items[UI_MENU_INGAME_STOP_SEEK].item_state == MENU_STATE_ENABLED) {
                 if (global.view.info_panel.size > FICS_STATSLOG_MSG_ROW) {
                     plat_draw_clear_statslog_area(FICS_STATSLOG_MSG_ROW);
                 }
-                ui_in_game_menu.menu_items[UI_MENU_INGAME_NEW].item_state = MENU_STATE_HIDDEN;
-                ui_in_game_menu.menu_items[UI_MENU_INGAME_STOP_SEEK].item_state = MENU_STATE_HIDDEN;
+                menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_NEW, MENU_STATE_HIDDEN);
+                menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_STOP_SEEK, MENU_STATE_HIDDEN);
                 if (global.state.includes_me) {
-                    ui_in_game_menu.menu_items[UI_MENU_INGAME_RESIGN].item_state = MENU_STATE_ENABLED;
+                    menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_RESIGN, MENU_STATE_ENABLED);
                 } else {
-                    ui_in_game_menu.menu_items[UI_MENU_INGAME_UNOBSERVE].item_state = MENU_STATE_ENABLED;
+                    menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_UNOBSERVE, MENU_STATE_ENABLED);
                 }
             }
             log_clear(&global.view.info_panel);
@@ -608,6 +654,32 @@ static void fics_ndcb_update_from_server(const char *buf, int len) {
             // 'W'
             fics_add_status_log(global.text.word_next, *global.frame.color_to_move == '\x57' ? global.text.side_label[SIDE_WHITE] : global.text.side_label[SIDE_BLACK]);
             fics_add_status_log(global.text.word_last, global.frame.previous_move);
+            if (zobrist.repeats > 1) {
+                // '0'
+                char seen[2] = {'\x30', '\0'};
+                seen[0] += MIN(zobrist.repeats, 9);
+                fics_add_status_log(global.text.word_repeat, seen);
+            }
+            PERF_SPAN_END(PERF_SPAN_STYLE12);
+#ifdef RETROMATE_ENGINE
+            if (changed) {
+                engine_position();
+            }
+#endif
+#ifdef RETROMATE_BOOK
+            if (changed) {
+                book_position();
+            }
+#endif
+#ifdef RETROMATE_ARCHIVE
+            if (changed) {
+                archive_position();
+            }
+#else
+            if (changed) {
+                review_commit();
+            }
+#endif
 
             // Move past all this to see if there are more statements to parse (Game Over comes with last
             // move in all cases I observed)
@@ -632,6 +704,16 @@ static void fics_ndcb_update_from_server(const char *buf, int len) {
                 if (!(*parse_point == FICS_DATA_CREATING[0] && 0 == strncmp(parse_point, FICS_DATA_CREATING, (sizeof(FICS_DATA_CREATING) - 1)))) {
                     // but if not, it's a game over message
                     global.state.game_active = false;
+#ifdef RETROMATE_ENGINE
+                    // A game I played can be looked at now that it's over
+                    engine_position();
+#endif
+#ifdef RETROMATE_BOOK
+                    book_position();
+#endif
+#ifdef RETROMATE_ARCHIVE
+                    archive_game_over(parse_point, len);
+#endif
                 }
                 // Whatever message, show it
                 fics_format_stats_message(parse_point, len, '\x7d'); // '}'
@@ -645,13 +727,11 @@ static void fics_ndcb_update_from_server(const char *buf, int len) {
             // Force a refresh to see what menu item states should be active
             plat_net_send(FICS_CMD_REFRESH);
         } else if (character == FICS_DATA_QUIESCENCE[0] && 0 == strncmp(parse_point, FICS_DATA_QUIESCENCE, (sizeof(FICS_DATA_QUIESCENCE) - 1))) {
-            ui_in_game_menu.menu_items[UI_MENU_INGAME_NEW].item_state = MENU_STATE_ENABLED;
-            ui_in_game_menu.menu_items[UI_MENU_INGAME_RESIGN].item_state = MENU_STATE_HIDDEN;
-            ui_in_game_menu.menu_items[UI_MENU_INGAME_UNOBSERVE].item_state = MENU_STATE_HIDDEN;
+            menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_NEW, MENU_STATE_ENABLED);
+            menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_RESIGN, MENU_STATE_HIDDEN);
+            menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_DRAW, MENU_STATE_HIDDEN);
+            menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_UNOBSERVE, MENU_STATE_HIDDEN);
             global.state.game_active = false;
-            if (global.view.mc.m && !(global.view.mc.df & MENU_DRAW_HIDDEN)) {
-                global.view.mc.df = MENU_DRAW_REDRAW;
-            }
         } else if (character == FICS_DATA_SAYS[0] && 0 == strncmp(parse_point, FICS_DATA_SAYS, (sizeof(FICS_DATA_SAYS) - 1))) {
             // says: received - show what was said
             parse_point += (sizeof(FICS_DATA_SAYS) - 1);
@@ -671,6 +751,28 @@ static void fics_ndcb_update_from_server(const char *buf, int len) {
     }
 }
 
+#ifdef RETROMATE_BENCH
+/*-----------------------------------------------------------------------*/
+// Lets bench.c time the in-game parser without a server
+void fics_bench_update(const char *buf, int len) {
+    fics_ndcb_update_from_server(buf, len);
+}
+
+/*-----------------------------------------------------------------------*/
+// Like fics_table_query, but nothing is sent.  bench.c feeds the rows with
+// fics_bench_table_feed, and never a summary, so the table doesn't end
+void fics_bench_table_start(const fics_schema_t *schema, fics_row_callback_t row_callback) {
+    memset(&fics_data.table, 0, sizeof(fics_data.table));
+    fics_data.table.schema = schema;
+    fics_data.table.row_callback = row_callback;
+}
+
+/*-----------------------------------------------------------------------*/
+void fics_bench_table_feed(const char *buf, int len) {
+    fics_table_feed(buf, len);
+}
+#endif
+
 /*-----------------------------------------------------------------------*/
 void fics_init() {
     plat_net_connect(global.ui.server_name, global.ui.server_port);
@@ -699,12 +801,9 @@ uint8_t fics_letter_to_piece(char letter) {
 
 /*-----------------------------------------------------------------------*/
 void fics_play(bool use_seek) {
-    ui_in_game_menu.menu_items[UI_MENU_INGAME_NEW].item_state = MENU_STATE_HIDDEN;
+    menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_NEW, MENU_STATE_HIDDEN);
     if (use_seek) {
-        ui_in_game_menu.menu_items[UI_MENU_INGAME_STOP_SEEK].item_state = MENU_STATE_ENABLED;
-        if (!(global.view.mc.df & MENU_DRAW_HIDDEN)) {
-            global.view.mc.df = MENU_DRAW_REDRAW;
-        }
+        menu_item_state(&ui_in_game_menu, UI_MENU_INGAME_STOP_SEEK, MENU_STATE_ENABLED);
         // 'u' 'i' 'r'
         if (global.ui.my_game_type[1] == '\x75' || global.ui.my_game_type[1] == '\x69' || global.ui.my_game_type[1] == '\x72') {
             strcpy(&global.setup.seek_cmd[5], global.ui.my_game_type);
@@ -712,10 +811,9 @@ void fics_play(bool use_seek) {
         }
     } else {
         // Init the search cache
-        memset(&fics_data, 0, sizeof(fics_data));
+        fics_data.game_number_str[0] = '\0';
         fics_data.rating_delta = -1;
-        fics_set_new_data_callback(fics_ndcb_sought_list);
-        plat_net_send(FICS_CMD_SOUGHT);
+        fics_table_query(&fics_schema_sought, fics_rcb_sought, fics_tdcb_sought);
     }
 }
 
@@ -737,14 +835,25 @@ void fics_shutdown() {
     plat_net_send(FICS_CMD_QUIT);
 }
 
+/*-----------------------------------------------------------------------*/
+void fics_table_query(const fics_schema_t *schema, fics_row_callback_t row_callback, fics_table_done_t done_callback) {
+    memset(&fics_data.table, 0, sizeof(fics_data.table));
+    fics_data.table.schema = schema;
+    fics_data.table.row_callback = row_callback;
+    fics_data.table.done_callback = done_callback;
+    fics_set_new_data_callback(fics_ndcb_table);
+    plat_net_send(schema->command);
+}
+
 /*-----------------------------------------------------------------------*/
 void fics_tcp_recv(const unsigned char *buf, int len) {
+    PERF_COUNT(PERF_TCP_RECV_CALLS, 1);
     if (len == -1) {
         app_error(false, "TCP recv error.");
         app_set_state(APP_STATE_OFFLINE);
     } else {
         const char *match;
-        log_add_line(&global.view.terminal, (const char *)buf, len);
+        log_add_text(&global.view.terminal, (const char *)buf, len);
         if (global.fics.match_callback) {
             if ((match = fics_strnstr((const char *)buf, len, global.fics.trigger_text))) {
                 (*global.fics.match_callback)((const char *)buf, len, match);
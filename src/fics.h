@@ -21,31 +21,100 @@ void fics_set_trigger_callback(const char *text, fics_match_callback_t callback)
 void fics_shutdown(void);
 void fics_tcp_recv(const unsigned char *buf, int len);
 
+// Table columns.  A token that isn't a number ends an INT column's row
 enum {
-    SOUGHT_GAME_NUM,                // 0
-    SOUGHT_RANKING,                 // 1
-    SOUGHT_USER_NAME,               // 2
-    SOUGHT_START_TIME,              // 3
-    SOUGHT_INC_TIME,                // 4
-    SOUGHT_RATED,                   // 5
-    SOUGHT_GAME_TYPE,               // 6
-    SOUGHT_START_COLOR,             // 7
-    SOUGHT_RANGE,                   // 8
-    SOUGHT_EXTRA,                   // 9
-    SOUGHT_COUNT,                   // 10 - Number of words - all words before this
+    FICS_COL_INT,                   // int16_t, "++++" and "----" read as 0
+    FICS_COL_STR,                   // char[size], truncated to fit
+    FICS_COL_SKIP,                  // Token is consumed but not kept
 };
 
+#define FICS_COL_OPTIONAL           0x80    // Only if the token starts with a char in accept
+#define FICS_TOKEN_MAX              23      // Longer tokens are truncated
+
+typedef struct _fics_column {
+    uint8_t kind;                               // FICS_COL_* | FICS_COL_OPTIONAL
+    uint8_t offset;                             // Where in the record the field is
+    uint8_t size;                               // Size of the field in the record
+    const char *accept;                         // Lead characters for an optional column
+} fics_column_t;
+
+// Describes the rows of a table the server sends in response to command
+typedef struct _fics_schema {
+    const char *command;                        // What to send to get the table
+    const fics_column_t *columns;
+    uint8_t num_columns;
+    const char *breaks;                         // Characters that are a token by themselves
+    const char *end_word;                       // This word, or with a '.', on a line that isn't a row ends the table
+} fics_schema_t;
+
+// Called with each complete row, and the number of tokens on the line past the
+// last column.  The record is reused for the next row
+typedef void (*fics_row_callback_t)(const void *record, uint8_t extra);
+typedef void (*fics_table_done_t)(void);
+
+// Tokenizer state - it's fed a character at a time, so rows may be split
+// across any number of receive chunks
+typedef struct _fics_table {
+    const fics_schema_t *schema;
+    fics_row_callback_t row_callback;
+    fics_table_done_t done_callback;
+    uint8_t column;                             // Column the next token goes into
+    uint8_t extra;                              // Tokens past the last column
+    uint8_t tok_len;
+    bool skip_line;                             // Line didn't fit the schema
+    bool done;                                  // end_word seen
+    char tok[FICS_TOKEN_MAX + 1];
+} fics_table_t;
+
+// sought - "  5 1500 GuestABCD(U)  15   0 unrated standard [white]  0-9999 m"
+typedef struct _fics_sought {
+    char game_number[6];
+    int16_t rating;
+    char user_name[18 + 1];
+    int16_t start_time;
+    int16_t inc_time;
+    char rated[1 + 1];
+    char game_type[11 + 1];
+    char start_color[7 + 1];                    // Empty if no color preference
+    char range[9 + 1];
+} fics_sought_t;
+
+// games - " 93 2036 WFMKierzek  2229 FMKarl     [ br  3   0]  2:22 -  3:06 (18-18) W: 42"
+typedef struct _fics_game {
+    int16_t game_number;
+    int16_t w_rating;
+    char w_name[18 + 1];
+    int16_t b_rating;
+    char b_name[18 + 1];
+    char game_type[3 + 1];                      // [p]<type><rated>
+    int16_t initial_time;
+    int16_t time_increment;
+    char w_clock[7 + 1];
+    char b_clock[7 + 1];
+    char color_to_move[1 + 1];
+    int16_t move_number;
+} fics_game_t;
+
 typedef struct _fics_data {
-    char status;                                // okay, error, need more data
-    char parse_state;                           // what to look for in incoming sought data
-    const char *parse_point;                    // Where in the buffer the parser is looking
-    int length;                                 // length left beyond parse_point to search
-    const char *sought_word[SOUGHT_COUNT];      // the words found in the current "line" - start ptr
-    int sought_word_len[SOUGHT_COUNT];          // character count of words in sought_words
+    fics_table_t table;                         // Tokenizer state for the table being received
+    union {
+        fics_sought_t sought;
+        fics_game_t game;
+    } record;                                   // Where the columns of a row are unpacked
     char game_number_str[6];                    // The sought game to play's game number
     uint16_t rating_delta;                      // Used to determine best opponent (closest rating match)
 } fics_data_t;
 
+extern const fics_schema_t fics_schema_sought;
+extern const fics_schema_t fics_schema_games;
+
+void fics_table_query(const fics_schema_t *schema, fics_row_callback_t row_callback, fics_table_done_t done_callback);
+#ifdef RETROMATE_BENCH
+void fics_bench_table_feed(const char *buf, int len);
+void fics_bench_table_start(const fics_schema_t *schema, fics_row_callback_t row_callback);
+void fics_bench_update(const char *buf, int len);
+#endif
+
 extern fics_data_t fics_data;
 
 #endif //_FICS_H_
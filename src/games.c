@@ -0,0 +1,211 @@
+/*
+ *  games.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include <string.h>
+
+#include "global.h"
+
+// Server data, so ASCII encoded as hex (see fics.c)
+                                    // "sbluzwS" - the order of ui_game_types
+#define GAMES_TYPE_ORDER            "\x73\x62\x6c\x75\x7a\x77\x53"
+                                    // "p"
+#define GAMES_TYPE_PRIVATE          '\x70'
+                                    // "++++"
+#define GAMES_NO_RATING             "\x2b\x2b\x2b\x2b"
+
+#define GAMES_CMD_OBSERVE           "observe "
+#define GAMES_CMD_UNOBSERVE         "unobserve"
+
+games_t games;
+
+/*-----------------------------------------------------------------------*/
+// Games sort high to low on the key.  For type, the type is in the top 4 bits
+static uint16_t games_key(char type, int16_t w_rating, int16_t b_rating) {
+    uint16_t strength = (uint16_t)(w_rating + b_rating) >> 1;
+    if (games.sort == GAMES_SORT_TYPE) {
+        const char *rank = type ? strchr(GAMES_TYPE_ORDER, type) : NULL;
+        uint8_t order = rank ? rank - GAMES_TYPE_ORDER : 15;
+        return ((15 - order) << 12) | MIN(strength, 4095);
+    }
+    return strength;
+}
+
+/*-----------------------------------------------------------------------*/
+// Move slot down from pos in order till it's past every game with a lower key
+static void games_insert(uint16_t slot, uint16_t pos) {
+    uint16_t key = games.key[slot];
+    while (pos && games.key[games.order[pos - 1]] < key) {
+        games.order[pos] = games.order[pos - 1];
+        pos--;
+    }
+    games.order[pos] = slot;
+}
+
+/*-----------------------------------------------------------------------*/
+// Write value in decimal, right justified in width.  Returns the end
+static char *games_put_number(char *dest, uint16_t value, uint8_t width) {
+    char digits[5];
+    uint8_t i = 0;
+    do {
+        digits[i++] = '\x30' + value % 10; // '0'
+        value /= 10;
+    } while (value);
+    while (width > i) {
+        *dest++ = '\x20';
+        width--;
+    }
+    while (i) {
+        *dest++ = digits[--i];
+    }
+    return dest;
+}
+
+/*-----------------------------------------------------------------------*/
+static char *games_put_player(char *dest, int16_t rating, const char *name) {
+    uint8_t len = strlen(name);
+    if (rating > 0) {
+        dest = games_put_number(dest, rating, 4);
+    } else {
+        memcpy(dest, GAMES_NO_RATING, 4);
+        dest += 4;
+    }
+    *dest++ = '\x20';
+    memcpy(dest, name, len);
+    memset(dest + len, '\x20', GAMES_NAME_LEN - len);
+    dest += GAMES_NAME_LEN;
+    *dest++ = '\x20';
+    return dest;
+}
+
+/*-----------------------------------------------------------------------*/
+// Format the top games into the observe menu
+static void games_make_rows(void) {
+    char row[GAMES_ROW_LEN];
+    char *end;
+    uint8_t i;
+    uint16_t slot;
+
+    for (i = 0; i < GAMES_MENU_ITEMS; i++) {
+        if (i >= games.count) {
+            ui_observe_menu.menu_items[i].item_state = MENU_STATE_HIDDEN;
+            continue;
+        }
+        slot = games.order[i];
+        end = games_put_player(row, games.w_rating[slot], games.w_name[slot]);
+        end = games_put_player(end, games.b_rating[slot], games.b_name[slot]);
+        *end++ = games.type[slot];
+        *end++ = games.rated[slot];
+        plat_core_copy_ascii_to_display(games.rows[i], row, end - row);
+        games.rows[i][end - row] = '\0';
+        ui_observe_menu.menu_items[i].item_state = MENU_STATE_ENABLED;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+static void games_rcb_game(const void *record, uint8_t extra) {
+    const fics_game_t *game = (const fics_game_t *)record;
+    const char *type = game->game_type;
+    uint16_t slot, pos, key;
+    UNUSED(extra);
+
+    if (*type == GAMES_TYPE_PRIVATE) {
+        type++;
+    }
+    key = games_key(type[0], game->w_rating, game->b_rating);
+
+    if (games.count < GAMES_MAX) {
+        slot = pos = games.count++;
+    } else {
+        // Full, so it has to beat the weakest game kept, which it replaces
+        pos = GAMES_MAX - 1;
+        slot = games.order[pos];
+        if (key <= games.key[slot]) {
+            return;
+        }
+    }
+
+    games.key[slot] = key;
+    games.number[slot] = game->game_number;
+    games.w_rating[slot] = game->w_rating;
+    games.b_rating[slot] = game->b_rating;
+    strncpy(games.w_name[slot], game->w_name, GAMES_NAME_LEN);
+    games.w_name[slot][GAMES_NAME_LEN] = '\0';
+    strncpy(games.b_name[slot], game->b_name, GAMES_NAME_LEN);
+    games.b_name[slot][GAMES_NAME_LEN] = '\0';
+    games.type[slot] = type[0];
+    games.rated[slot] = type[0] ? type[1] : '\0';
+    games.initial_time[slot] = MIN(game->initial_time, 255);
+    games.time_increment[slot] = MIN(game->time_increment, 255);
+    strncpy(games.w_clock[slot], game->w_clock, GAMES_CLOCK_LEN);
+    games.w_clock[slot][GAMES_CLOCK_LEN] = '\0';
+    strncpy(games.b_clock[slot], game->b_clock, GAMES_CLOCK_LEN);
+    games.b_clock[slot][GAMES_CLOCK_LEN] = '\0';
+    games.move_number[slot] = game->move_number;
+
+    games_insert(slot, pos);
+}
+
+/*-----------------------------------------------------------------------*/
+static void games_tdcb_games(void) {
+    games_make_rows();
+    // Show the list, even if the menu was hidden while waiting
+    ui_observe_menu.parent_menu = &ui_in_game_menu;
+    if (global.view.mc.df & MENU_DRAW_HIDDEN) {
+        global.view.mc.df |= MENU_DRAW_ERASE;
+    }
+    menu_set(&ui_observe_menu);
+}
+
+/*-----------------------------------------------------------------------*/
+void games_observe(uint8_t row) {
+    char *end;
+
+    if (row >= games.count) {
+        return;
+    }
+    // Only one observed game can show on the board
+    if (global.state.game_active && !global.state.includes_me) {
+        plat_net_send(GAMES_CMD_UNOBSERVE);
+    }
+    strcpy(global.view.scratch_buffer, GAMES_CMD_OBSERVE);
+    end = games_put_number(global.view.scratch_buffer + sizeof(GAMES_CMD_OBSERVE) - 1, games.number[games.order[row]], 0);
+    *end = '\0';
+    plat_net_send(global.view.scratch_buffer);
+}
+
+#ifdef RETROMATE_BENCH
+/*-----------------------------------------------------------------------*/
+// Lets bench.c time the games parse without a server
+void games_bench_start(void) {
+    games.count = 0;
+    fics_bench_table_start(&fics_schema_games, games_rcb_game);
+}
+#endif
+
+/*-----------------------------------------------------------------------*/
+void games_request(void) {
+    games.count = 0;
+    fics_table_query(&fics_schema_games, games_rcb_game, games_tdcb_games);
+}
+
+/*-----------------------------------------------------------------------*/
+void games_sort(uint8_t sort) {
+    uint16_t i, slot;
+
+    games.sort = sort;
+    for (i = 0; i < games.count; i++) {
+        slot = games.order[i];
+        games.key[slot] = games_key(games.type[slot], games.w_rating[slot], games.b_rating[slot]);
+    }
+    // Insertion sort - order is mostly sorted already when sorting by type
+    for (i = 1; i < games.count; i++) {
+        games_insert(games.order[i], i);
+    }
+    games_make_rows();
+}
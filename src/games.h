@@ -0,0 +1,62 @@
+/*
+ *  games.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#ifndef _GAMES_H_
+#define _GAMES_H_
+
+// The 8-bit machines only keep the games that make it into the menu
+#ifdef __CC65__
+#define GAMES_MAX               10
+#else
+#define GAMES_MAX               2048
+#endif
+
+#define GAMES_MENU_ITEMS        10
+#define GAMES_NAME_LEN          10
+#define GAMES_CLOCK_LEN         7
+// "2036 WFMKierzek 2229 FMKarl      br"
+#define GAMES_ROW_LEN           (4 + 1 + GAMES_NAME_LEN + 1 + 4 + 1 + GAMES_NAME_LEN + 1 + 2)
+
+enum {
+    GAMES_SORT_RATING,              // Strongest games first
+    GAMES_SORT_TYPE,                // Grouped by type, strongest first
+};
+
+// The games index is a struct of arrays, in the order the games arrived.
+// order has the slots in sort order, keyed on key, so only it moves
+typedef struct _games {
+    uint16_t count;
+    uint8_t sort;                                       // GAMES_SORT_*
+    uint16_t order[GAMES_MAX];
+    uint16_t key[GAMES_MAX];
+    int16_t number[GAMES_MAX];
+    int16_t w_rating[GAMES_MAX];
+    int16_t b_rating[GAMES_MAX];
+    char w_name[GAMES_MAX][GAMES_NAME_LEN + 1];
+    char b_name[GAMES_MAX][GAMES_NAME_LEN + 1];
+    char type[GAMES_MAX];                               // b, s, l, u, w, z, ...
+    char rated[GAMES_MAX];                              // r or u
+    uint8_t initial_time[GAMES_MAX];
+    uint8_t time_increment[GAMES_MAX];
+    char w_clock[GAMES_MAX][GAMES_CLOCK_LEN + 1];
+    char b_clock[GAMES_MAX][GAMES_CLOCK_LEN + 1];
+    int16_t move_number[GAMES_MAX];
+    char rows[GAMES_MENU_ITEMS][GAMES_ROW_LEN + 1];     // Menu text, in display format
+} games_t;
+
+extern games_t games;
+
+#ifdef RETROMATE_BENCH
+void games_bench_start(void);
+#endif
+void games_observe(uint8_t row);
+void games_request(void);
+void games_sort(uint8_t sort);
+
+#endif //_GAMES_H_
@@ -43,6 +43,8 @@ global_t global = {
             0,                                      // max length of all items
             0,                                      // max length of all actions
             0,                                      // working y
+            {0},                                    // active[MENU_ITEMS_MAX]
+            {0},                                    // dirty[MENU_ITEMS_MAX]
         },
         true,                                       // refresh
         {0, ' ', 0, ' '},                           // cursor_char[4]
@@ -142,6 +144,7 @@ global_t global = {
         "Game #",                                   // global.text.game_number
         "Last: ",                                   // global.text.word_last
         "Next: ",                                   // global.text.word_next
+        "Repeat: ",                                 // global.text.word_repeat
         "  ",                                       // global.text.word_spaces
         "Strength: ",                               // global.text.word_strength
         "Time: ",                                   // global.text.word_time
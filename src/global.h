@@ -16,12 +16,22 @@
 #include <stdbool.h>    // bool
 
 #include "app.h"
+#include "bench.h"
+#include "config.h"
 #include "fics.h"
+#include "games.h"
 #include "log.h"
 #include "menu.h"
+#include "movegen.h"
+#include "engine.h"
+#include "book.h"
+#include "archive.h"
+#include "perf.h"
 #include "plat.h"
+#include "review.h"
 #include "ui.h"
 #include "usrinput.h"
+#include "zobrist.h"
 
 // Helper
 #define AS(arr) (sizeof(arr) / sizeof((arr)[0]))
@@ -195,6 +205,7 @@ typedef struct _text {
     char *game_number;
     char *word_last;
     char *word_next;
+    char *word_repeat;
     char *word_spaces;
     char *word_strength;
     char *word_time;
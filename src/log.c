@@ -40,11 +40,147 @@ static inline void log_advance_line(tLog *log) {
     }
 }
 
+/*-----------------------------------------------------------------------*/
+// Split the next line off the front of text.  Returns the line length and
+// moves text and remaining past the line break (\r, \n, \r\n or \n\r)
+static int log_next_line(const char **text, int *remaining) {
+    int line_len;
+    const char *p = *text;
+    const char *newline = log_mempbrk(p, *remaining, "\x0d\x0a");
+
+    if (newline) {
+        uint8_t skip = 1;
+        char nl = *newline;
+        line_len = newline - p;
+
+        // If there's a following opposite newline (\n\r or \r\n), skip both
+        if ((newline + 1 < p + *remaining) &&
+                ((nl == '\x0a' && newline[1] == '\x0d') ||
+                 (nl == '\x0d' && newline[1] == '\x0a'))) {
+            skip = 2;
+        }
+
+        *remaining -= (line_len + skip);
+        *text = newline + skip;
+    } else {
+        line_len = *remaining;
+        *remaining = 0;
+    }
+    return line_len;
+}
+
+/*-----------------------------------------------------------------------*/
+// Once the log is full, the row about to be overwritten is the oldest.  Hand
+// it to the history first.  A view that's scrolled back stays where it is
+static void log_retire_row(tLog *log) {
+    if (!log->history_rows || log->size < log->rows) {
+        return;
+    }
+    plat_core_history_put(log->history_head, log->dest_ptr);
+    if (++log->history_head >= log->history_rows) {
+        log->history_head = 0;
+    }
+    if (log->history_size < log->history_rows) {
+        log->history_size++;
+    }
+    if (log->scroll && log->scroll < log->history_size) {
+        log->scroll++;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Copy one line into the log, wrapping it over as many rows as it needs
+static void log_copy_line(tLog *log, const char *line_start, int line_len) {
+    int chunk_len;
+
+    PERF_COUNT(PERF_LOG_LINES, 1);
+
+    if (line_len == 0) {
+        log_retire_row(log);
+        memset(log->dest_ptr, ' ', log->cols);
+        log_advance_line(log);
+        return;
+    }
+
+    while (line_len > 0) {
+        chunk_len = (line_len > log->cols) ? log->cols : line_len;
+        log_retire_row(log);
+        plat_core_copy_ascii_to_display(log->dest_ptr, line_start, chunk_len);
+
+        if (chunk_len < log->cols) {
+            memset(log->dest_ptr + chunk_len, ' ', log->cols - chunk_len);
+        }
+        line_start += chunk_len;
+        line_len -= chunk_len;
+        log_advance_line(log);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Find where the text that fills the last rows rows starts, counting a line
+// longer than cols as the rows it wraps over.  Anything before that would
+// scroll out of the log before it could be seen, so it is never copied.
+// One extra row is kept so that a \r\n pair split differently from how
+// log_next_line splits it can't cost a visible row
+static const char *log_visible_tail(tLog *log, const char *text, int text_len) {
+    const char *end = text + text_len;
+    const char *p = end;
+    uint16_t rows = 0;
+    int line_len;
+
+    while (p > text) {
+        char c = *--p;
+        if (c == '\x0a' || c == '\x0d') {
+            const char *after = p + 1;
+            line_len = end - after;
+            if (line_len) {
+                rows += (line_len + log->cols - 1) / log->cols;
+            } else if (end != text + text_len) {
+                // An empty line is a row, but nothing after the last break is
+                rows++;
+            }
+            if (rows > log->rows) {
+                return after;
+            }
+            if (p > text && (p[-1] == '\x0a' || p[-1] == '\x0d') && p[-1] != c) {
+                p--;
+            }
+            end = p;
+        }
+    }
+    return text;
+}
+
 /*-----------------------------------------------------------------------*/
 void log_clear(tLog *log) {
     log->head = log->size = 0;
     log->dest_ptr = log->buffer;
     log->modified = false;
+    log->span_head = log->span_count = 0;
+    log->history_head = log->history_size = log->scroll = 0;
+}
+
+/*-----------------------------------------------------------------------*/
+// Copy the deferred spans into the log.  The text they point at has to still
+// be valid, so the platform calls this before it reuses its receive buffer
+void log_commit(tLog *log) {
+    while (log->span_count) {
+        tLogSpan *span = &log->spans[log->span_head];
+        log_copy_line(log, span->text, span->len);
+        if (++log->span_head >= log->rows) {
+            log->span_head = 0;
+        }
+        log->span_count--;
+        log->modified = true;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Ask the platform for extended memory to keep the rows that scroll off
+void log_history_init(tLog *log) {
+    if (log->cols == LOG_HISTORY_COLS) {
+        log->history_rows = plat_core_history_init();
+    }
 }
 
 /*-----------------------------------------------------------------------*/
@@ -63,59 +199,110 @@ void log_init(tLog *log, uint8_t width, uint8_t height) {
 
 /*-----------------------------------------------------------------------*/
 void log_add_line(tLog *log, const char *text, int text_len) {
-    int remaining, chunk_len, line_len;
-    const char *p = text;
+    int remaining, line_len;
     const char *line_start;
-    const char *newline;
+
+    // Anything deferred arrived before this text
+    if (log->span_count) {
+        log_commit(log);
+    }
 
     remaining = (text_len < 0) ? strlen(text) : text_len;
     if (log->clip) {
         remaining = remaining > log->cols ? log->cols : remaining;
+    } else if (!log->history_rows && remaining > log->rows + 1) {
+        // Every row takes at least a byte of text, so shorter text can't fill
+        // more than the rows + 1 that are kept.  Otherwise, only copy what
+        // will still be on-screen once all of text is added
+        line_start = log_visible_tail(log, text, remaining);
+        remaining -= line_start - text;
+        text = line_start;
     }
 
     while (remaining > 0) {
-        // Determine the end of the current line (up to \n or end of string)
-        line_start = p;
-        newline = log_mempbrk(p, remaining, "\x0d\x0a");
-        if (newline) {
-            uint8_t skip = 1;
-            char nl = *newline;
-            line_len = newline - p;
-
-            // If there's a following opposite newline (\n\r or \r\n), skip both
-            if ((newline + 1 < p + remaining) &&
-                    ((nl == '\x0a' && newline[1] == '\x0d') ||
-                     (nl == '\x0d' && newline[1] == '\x0a'))) {
-                skip = 2;
-            }
+        line_start = text;
+        line_len = log_next_line(&text, &remaining);
+        log_copy_line(log, line_start, line_len);
+    }
+    log->modified = true;
+}
 
-            remaining -= (newline - p + skip);
-            p = newline + skip;
-        } else {
-            line_len = remaining;
-            remaining = 0;
-        }
+/*-----------------------------------------------------------------------*/
+// Received text.  If the platform keeps its receive buffer around (log->spans
+// is set) and the terminal is hidden, only note where the lines are.  Only the
+// last rows lines can be on screen, so without a history older spans are
+// dropped, never copied.  With one, the oldest is copied to make room
+void log_add_text(tLog *log, const char *text, int text_len) {
+    tLogSpan *span;
+    const char *line_start;
+    int line_len;
 
-        if (line_len == 0) {
-            if (line_len == 0) {
-                memset(log->dest_ptr, ' ', log->cols);
-            }
-            log_advance_line(log);
+    if (!log->spans || global.view.terminal_active) {
+        log_add_line(log, text, text_len);
+        return;
+    }
+
+    while (text_len > 0) {
+        line_start = text;
+        line_len = log_next_line(&text, &text_len);
+        if (log->span_count < log->rows) {
+            span = &log->spans[(log->span_head + log->span_count++) % log->rows];
         } else {
-            while (line_len > 0) {
-                chunk_len = (line_len > log->cols) ? log->cols : line_len;
-                plat_core_copy_ascii_to_display(log->dest_ptr, line_start, chunk_len);
-
-                if (chunk_len < log->cols) {
-                    memset(log->dest_ptr + chunk_len, ' ', log->cols - chunk_len);
-                }
-                line_start += chunk_len;
-                line_len -= chunk_len;
-                log_advance_line(log);
+            span = &log->spans[log->span_head];
+            if (log->history_rows) {
+                log_copy_line(log, span->text, span->len);
+                log->modified = true;
+            }
+            if (++log->span_head >= log->rows) {
+                log->span_head = 0;
             }
         }
+        span->text = line_start;
+        span->len = line_len;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Row i of the view, counting from the top.  Scrolled back, the top rows come
+// out of the history, into a buffer the platform owns, valid till the next call
+const char *log_row(tLog *log, uint8_t i) {
+    uint16_t line = log->history_size - log->scroll + i;
+    uint8_t row;
+
+    if (line < log->history_size) {
+        // The oldest retired row is at history_head once the history is full
+        line += log->history_head + log->history_rows - log->history_size;
+        if (line >= log->history_rows) {
+            line -= log->history_rows;
+        }
+        return plat_core_history_get(line);
+    }
+
+    row = line - log->history_size;
+    if (log->size >= log->rows) {
+        row += log->head;
+        if (row >= log->rows) {
+            row -= log->rows;
+        }
+    }
+    return log->buffer + row * log->cols;
+}
+
+/*-----------------------------------------------------------------------*/
+// Scroll the view back (rows > 0) into the history, or forward toward the
+// newest rows.  Stops at either end
+void log_scroll(tLog *log, int rows) {
+    int scroll = log->scroll + rows;
+
+    if (scroll < 0) {
+        scroll = 0;
+    } else if (scroll > log->history_size) {
+        scroll = log->history_size;
+    }
+    if (scroll != log->scroll) {
+        log->scroll = scroll;
+        log->modified = true;
     }
-    log->modified = true;
 }
 
 /*-----------------------------------------------------------------------*/
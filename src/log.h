@@ -10,6 +10,17 @@
 #ifndef LOG_H
 #define LOG_H
 
+// Rows retired from the terminal are kept in extended memory, if the platform
+// has some.  Only a log this wide keeps a history
+#define LOG_HISTORY_COLS    80
+#define LOG_HISTORY_MAX     8192        // Rows, whatever the hardware has
+
+// A line of received text that has not yet been copied into the log
+typedef struct _tLogSpan {
+    const char *text;           // Start of the line (in the receive buffer)
+    int len;                    // Length, excluding the line break
+} tLogSpan;
+
 typedef struct _tLog {
     char *buffer;               // Log data storage
     unsigned int buffer_size;   // Size of buffer in bytes
@@ -20,11 +31,23 @@ typedef struct _tLog {
     uint8_t rows;               // How many rows before wrapping
     bool modified;              // log_add_* sets to 1
     bool clip;                  // log_add_line copies onlt cols chars
+    tLogSpan *spans;            // rows spans - if set, log_add_text defers while hidden
+    uint8_t span_head;          // Oldest deferred span
+    uint8_t span_count;         // How many spans are deferred
+    uint16_t history_rows;      // Rows plat_core_history_* can keep, 0 for none
+    uint16_t history_head;      // Slot the next retired row goes to
+    uint16_t history_size;      // How many rows retired
+    uint16_t scroll;            // Rows the view is scrolled back into the history
 } tLog;
 
 void log_add_line(tLog *log, const char *text, int text_len);
+void log_add_text(tLog *log, const char *text, int text_len);
 void log_clear(tLog *log);
+void log_commit(tLog *log);
+void log_history_init(tLog *log);
 void log_init(tLog *log, uint8_t width, uint8_t height);
+const char *log_row(tLog *log, uint8_t i);
+void log_scroll(tLog *log, int rows);
 void log_shutdown(tLog *log);
 
 #endif // LOG_H
@@ -15,24 +15,72 @@ int main() {
     log_init(&global.view.info_panel, plat_core_get_cols() - plat_core_get_status_x(), plat_core_get_rows());
 
     plat_core_init();
-    plat_net_init();
-
     global.view.info_panel.clip = true;
+    log_history_init(&global.view.terminal);
+    zobrist_init();
+
+#ifdef RETROMATE_BENCH
+    // The _bench builds only time things, and report, without a network
+    bench_run();
+#else
+    plat_net_init();
+    config_load();
     app_set_state(APP_STATE_OFFLINE);
+#ifdef RETROMATE_PERF
+    perf_init();
+#endif
+#ifdef RETROMATE_ENGINE
+    engine_init();
+#endif
+#ifdef RETROMATE_BOOK
+    book_init();
+#endif
+#ifdef RETROMATE_ARCHIVE
+    archive_init();
+#endif
+    if (ui_pregame_menu_options_menu.menu_items[UI_LOGIN_OPTIONS_AUTO_CONNECT].selected) {
+        // Straight to Play Online
+        app_connect();
+    }
 
     while (!global.app.quit) {
         plat_core_key_input(&global.os.input_event);
+        app_user_input();
+        PERF_MARK(PERF_KEY_INPUT);
         app_draw_update();
+        PERF_MARK(PERF_APP_DRAW);
         global.app.selection = menu_tick();
+        PERF_MARK(PERF_MENU_TICK);
         global.app.tick();
+        PERF_MARK(PERF_APP_TICK);
         plat_net_update();
+        PERF_MARK(PERF_NET_UPDATE);
         plat_draw_update();
+        PERF_MARK(PERF_PLAT_DRAW);
     }
 
     plat_net_shutdown();
+    // Settings changed in a game are kept too
+    config_save();
+#ifdef RETROMATE_ARCHIVE
+    // A game that just ended is on disk before the writer goes
+    archive_shutdown();
+#endif
+#ifdef RETROMATE_PERF
+    perf_dump();
+#endif
+#endif
+
     log_shutdown(&global.view.info_panel);
     log_shutdown(&global.view.terminal);
     plat_core_shutdown();
+#ifdef RETROMATE_ENGINE
+    // After the platform ended the search thread
+    engine_shutdown();
+#endif
+#ifdef RETROMATE_BOOK
+    book_shutdown();
+#endif
 
     return 0;
 }
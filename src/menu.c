@@ -78,17 +78,9 @@ void menu_show_item(menu_item_t *item, uint8_t draw_flag) {
 }
 
 /*-----------------------------------------------------------------------*/
+// menu_cache counted these when it laid the menu out
 uint8_t menu_count_active(uint8_t index) {
-    menu_t *m = global.view.mc.m;
-    uint8_t count = m->menu_items[index].item_state != MENU_STATE_HIDDEN;
-
-    while (index) {
-        index--;
-        if (m->menu_items[index].item_state != MENU_STATE_HIDDEN) {
-            count++;
-        }
-    }
-    return count;
+    return global.view.mc.active[index];
 }
 
 /*-----------------------------------------------------------------------*/
@@ -96,7 +88,7 @@ static void menu_cache(menu_t *m) {
     uint8_t i, j, length, sel = 0;
     uint8_t height = 0;
 
-    if(m->selected_item > m->num_items || m->menu_items[m->selected_item].item_state != MENU_STATE_ENABLED) {
+    if(m->selected_item >= m->num_items || m->menu_items[m->selected_item].item_state != MENU_STATE_ENABLED) {
         m->selected_item = 0;
     }
 
@@ -105,10 +97,13 @@ static void menu_cache(menu_t *m) {
     global.view.mc.ix_max = global.view.mc.ax_max = 0;
 
     for (i = 0; i < m->num_items; i++) {
+        global.view.mc.dirty[i] = false;
         if (m->menu_items[i].item_state == MENU_STATE_HIDDEN) {
+            global.view.mc.active[i] = height;
             continue;
         }
         height++;
+        global.view.mc.active[i] = height;
         if (i == m->selected_item) {
             // This bakes into sel the title offset, coming here
             sel = height;
@@ -188,6 +183,34 @@ static void menu_change_selection(uint8_t new) {
     m->selected_item = new;
 }
 
+/*-----------------------------------------------------------------------*/
+// Showing or hiding an item moves the ones below it, so that lays the menu
+// out again.  Enabled to disabled, or back, only repaints the item's row
+void menu_item_state(menu_t *m, uint8_t index, item_state_t state) {
+    menu_item_t *item = &m->menu_items[index];
+    bool was_hidden = item->item_state == MENU_STATE_HIDDEN;
+
+    if (item->item_state == state) {
+        return;
+    }
+    item->item_state = state;
+
+    // If it's not on screen, menu_cache sees the new state when it is
+    if (m != global.view.mc.m || (global.view.mc.df & MENU_DRAW_HIDDEN)) {
+        return;
+    }
+
+    if (was_hidden != (state == MENU_STATE_HIDDEN)) {
+        // Erase with the old layout, then cache and draw the new one
+        global.view.mc.nm = m;
+        global.view.mc.m = NULL;
+        global.view.mc.df |= MENU_DRAW_REDRAW;
+    } else {
+        global.view.mc.dirty[index] = true;
+        global.view.mc.df |= MENU_DRAW_ITEM_DRAW;
+    }
+}
+
 /*-----------------------------------------------------------------------*/
 static void menu_next_item() {
     menu_t *m = global.view.mc.m;
@@ -284,6 +307,7 @@ uint8_t menu_tick() {
         // All the items
         for (i = 0; i < m->num_items; i++) {
             menu_item_t *item = &m->menu_items[i];
+            global.view.mc.dirty[i] = false;
             if (item->item_state != MENU_STATE_HIDDEN) {
                 global.view.mc.iy++;
                 menu_show_item(item, MENU_ITEM_DRAW);
@@ -301,6 +325,20 @@ uint8_t menu_tick() {
             // will erase and draw on same item - sel
             menu_change_selection(sel);
         }
+    } else if (global.view.mc.df & MENU_DRAW_ITEM_DRAW) {
+        // Only the items that changed state
+        for (i = 0; i < m->num_items; i++) {
+            if (global.view.mc.dirty[i]) {
+                global.view.mc.dirty[i] = false;
+                global.view.mc.iy = global.view.mc.y + 1 + global.view.mc.active[i];
+                menu_show_item(&m->menu_items[i], MENU_ITEM_DRAW);
+            }
+        }
+        global.view.mc.df &= ~MENU_DRAW_ITEM_DRAW;
+        // The selected item may be one that was disabled
+        if (m->menu_items[sel].item_state != MENU_STATE_ENABLED) {
+            menu_prev_item();
+        }
     }
 
     if (global.os.input_event.code != INPUT_UNKNOWN) {
@@ -16,6 +16,12 @@
 #define MENU_SELECT_BACK    0xFE
 #define MENU_SELECT_NONE    0xFF
 
+// The most items any menu has (the observe menu)
+#define MENU_ITEMS_MAX      16
+
+// Fails to compile if items has more entries than the menu cache can lay out
+#define MENU_ITEMS_CHECK(items) typedef char items##_fit[AS(items) <= MENU_ITEMS_MAX ? 1 : -1]
+
 // Forward declarations
 typedef struct _menu menu_t;
 
@@ -106,8 +112,12 @@ typedef struct _menu_cache {
     uint8_t ix_max;     // max length of all items
     uint8_t ax_max;     // max length of all actions
     uint8_t iy;         // working y
+    uint8_t active[MENU_ITEMS_MAX];     // Visible items up to and including this one
+    uint8_t dirty[MENU_ITEMS_MAX];      // Item to repaint on the next tick
 } menu_cache_t;
 
+// Change an item's state, repainting only what that needs if m is on screen
+void menu_item_state(menu_t *m, uint8_t index, item_state_t state);
 // Prep menu_tick for the menu it will tick over
 void menu_set(menu_t *m);
 // Ticks the menu system (non-blocking call in a loop)
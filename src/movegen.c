@@ -0,0 +1,425 @@
+/*
+ *  movegen.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include <string.h>
+
+#include "global.h"
+
+// Steps on the 0x88 board.  The first 4 king steps are the diagonals
+static const int8_t movegen_king_steps[8] = {17, 15, -15, -17, 16, 1, -1, -16};
+static const int8_t movegen_knight_steps[8] = {33, 31, 18, 14, -14, -18, -31, -33};
+#define movegen_diagonal_steps  (&movegen_king_steps[0])
+#define movegen_straight_steps  (&movegen_king_steps[4])
+
+// Indexed by the piece enum, lower case
+                                            // "-rnbqkp"
+static const char movegen_letters[] = "\x2d\x72\x6e\x62\x71\x6b\x70";
+
+/*-----------------------------------------------------------------------*/
+static move_t *movegen_add(move_t *moves, uint8_t from, uint8_t to, uint8_t flags) {
+    moves->from = from;
+    moves->to = to;
+    moves->promote = NONE;
+    moves->flags = flags;
+    return moves + 1;
+}
+
+/*-----------------------------------------------------------------------*/
+// A pawn move onto the last rank is 4 moves, one for each promotion
+static move_t *movegen_add_pawn(move_t *moves, uint8_t from, uint8_t to, uint8_t flags) {
+    uint8_t rank = MOVEGEN_RANK(to);
+    uint8_t piece;
+
+    if (rank && rank != 7) {
+        return movegen_add(moves, from, to, flags);
+    }
+    for (piece = QUEEN; piece >= ROOK; piece--) {
+        moves = movegen_add(moves, from, to, flags);
+        moves[-1].promote = piece;
+    }
+    return moves;
+}
+
+/*-----------------------------------------------------------------------*/
+// The rights lost when a piece moves from, or is captured on, square
+static uint8_t movegen_castle_lost(uint8_t square) {
+    switch (square) {
+        case 0x00: return MOVEGEN_CASTLE_WQ;
+        case 0x04: return MOVEGEN_CASTLE_WK | MOVEGEN_CASTLE_WQ;
+        case 0x07: return MOVEGEN_CASTLE_WK;
+        case 0x70: return MOVEGEN_CASTLE_BQ;
+        case 0x74: return MOVEGEN_CASTLE_BK | MOVEGEN_CASTLE_BQ;
+        case 0x77: return MOVEGEN_CASTLE_BK;
+    }
+    return 0;
+}
+
+/*-----------------------------------------------------------------------*/
+// The king and the squares between it and the rook must be safe and empty
+static move_t *movegen_castles(const position_t *p, move_t *moves, uint8_t king) {
+    uint8_t side = p->side;
+    uint8_t rook = ROOK | (side ? PIECE_WHITE : 0);
+    uint8_t them = side ^ 1;
+    uint8_t rights = p->castle >> (side ? 0 : 2);
+
+    if (!(rights & (MOVEGEN_CASTLE_WK | MOVEGEN_CASTLE_WQ)) || movegen_attacked(p, king, them)) {
+        return moves;
+    }
+    if ((rights & MOVEGEN_CASTLE_WK) && p->board[king + 3] == rook &&
+            !p->board[king + 1] && !p->board[king + 2] && !movegen_attacked(p, king + 1, them)) {
+        moves = movegen_add(moves, king, king + 2, MOVEGEN_CASTLE);
+    }
+    if ((rights & MOVEGEN_CASTLE_WQ) && p->board[king - 4] == rook &&
+            !p->board[king - 1] && !p->board[king - 2] && !p->board[king - 3] && !movegen_attacked(p, king - 1, them)) {
+        moves = movegen_add(moves, king, king - 2, MOVEGEN_CASTLE);
+    }
+    return moves;
+}
+
+/*-----------------------------------------------------------------------*/
+static uint8_t movegen_letter_to_piece(char letter) {
+    uint8_t piece;
+    char lower = letter | 0x20;
+
+    for (piece = ROOK; piece <= PAWN; piece++) {
+        if (movegen_letters[piece] == lower) {
+            return piece | (letter == lower ? 0 : PIECE_WHITE);
+        }
+    }
+    return NONE;
+}
+
+/*-----------------------------------------------------------------------*/
+static move_t *movegen_pawn(const position_t *p, move_t *moves, uint8_t from) {
+    uint8_t side = p->side;
+    uint8_t to, target;
+    int8_t forward = side ? 16 : -16;
+
+    // A pawn is never on the last rank, so one step forward is on the board
+    to = from + forward;
+    if (!p->board[to]) {
+        moves = movegen_add_pawn(moves, from, to, 0);
+        if (MOVEGEN_RANK(from) == (side ? 1 : 6) && !p->board[(uint8_t)(to + forward)]) {
+            moves = movegen_add(moves, from, to + forward, MOVEGEN_DOUBLE_PUSH);
+        }
+    }
+    for (to = from + forward - 1; to != (uint8_t)(from + forward + 3); to += 2) {
+        if (MOVEGEN_OFF_BOARD(to)) {
+            continue;
+        }
+        if (to == p->ep) {
+            moves = movegen_add(moves, from, to, MOVEGEN_CAPTURE | MOVEGEN_EN_PASSANT);
+        } else {
+            target = p->board[to];
+            if (target && MOVEGEN_SIDE(target) != side) {
+                moves = movegen_add_pawn(moves, from, to, MOVEGEN_CAPTURE);
+            }
+        }
+    }
+    return moves;
+}
+
+/*-----------------------------------------------------------------------*/
+// Knights and kings take one step in each direction, the rest keep going
+// till they hit something
+static move_t *movegen_steps(const position_t *p, move_t *moves, uint8_t from, const int8_t *steps, uint8_t count, bool slide) {
+    uint8_t i, to, target;
+
+    for (i = 0; i < count; i++) {
+        to = from;
+        while (1) {
+            to += steps[i];
+            if (MOVEGEN_OFF_BOARD(to)) {
+                break;
+            }
+            target = p->board[to];
+            if (target) {
+                if (MOVEGEN_SIDE(target) != p->side) {
+                    moves = movegen_add(moves, from, to, MOVEGEN_CAPTURE);
+                }
+                break;
+            }
+            moves = movegen_add(moves, from, to, 0);
+            if (!slide) {
+                break;
+            }
+        }
+    }
+    return moves;
+}
+
+/*-----------------------------------------------------------------------*/
+bool movegen_attacked(const position_t *p, uint8_t square, uint8_t by_side) {
+    uint8_t i, from, piece;
+    uint8_t white = by_side ? PIECE_WHITE : 0;
+
+    // A white pawn attacks up the board, so it's below the square
+    from = square + (by_side ? -17 : 15);
+    if (!MOVEGEN_OFF_BOARD(from) && p->board[from] == (PAWN | white)) {
+        return true;
+    }
+    from += 2;
+    if (!MOVEGEN_OFF_BOARD(from) && p->board[from] == (PAWN | white)) {
+        return true;
+    }
+
+    for (i = 0; i < 8; i++) {
+        from = square + movegen_knight_steps[i];
+        if (!MOVEGEN_OFF_BOARD(from) && p->board[from] == (KNIGHT | white)) {
+            return true;
+        }
+        from = square + movegen_king_steps[i];
+        if (!MOVEGEN_OFF_BOARD(from) && p->board[from] == (KING | white)) {
+            return true;
+        }
+    }
+
+    // Look out from the square for the first piece in each direction
+    for (i = 0; i < 8; i++) {
+        from = square;
+        while (1) {
+            from += movegen_king_steps[i];
+            if (MOVEGEN_OFF_BOARD(from)) {
+                break;
+            }
+            piece = p->board[from];
+            if (piece) {
+                if (piece == (QUEEN | white) || piece == ((i < 4 ? BISHOP : ROOK) | white)) {
+                    return true;
+                }
+                break;
+            }
+        }
+    }
+    return false;
+}
+
+/*-----------------------------------------------------------------------*/
+// The moves may leave the king in check.  movegen_make says which do
+uint8_t movegen_generate(const position_t *p, move_t *moves) {
+    uint8_t from, piece;
+    move_t *start = moves;
+
+    for (from = 0; from < 0x78; from++) {
+        if (MOVEGEN_OFF_BOARD(from)) {
+            from += 7;
+            continue;
+        }
+        piece = p->board[from];
+        if (!piece || MOVEGEN_SIDE(piece) != p->side) {
+            continue;
+        }
+        switch (piece & ~PIECE_WHITE) {
+            case PAWN:
+                moves = movegen_pawn(p, moves, from);
+                break;
+            case KNIGHT:
+                moves = movegen_steps(p, moves, from, movegen_knight_steps, 8, false);
+                break;
+            case BISHOP:
+                moves = movegen_steps(p, moves, from, movegen_diagonal_steps, 4, true);
+                break;
+            case ROOK:
+                moves = movegen_steps(p, moves, from, movegen_straight_steps, 4, true);
+                break;
+            case QUEEN:
+                moves = movegen_steps(p, moves, from, movegen_king_steps, 8, true);
+                break;
+            case KING:
+                moves = movegen_steps(p, moves, from, movegen_king_steps, 8, false);
+                if (p->castle && from == (p->side ? 0x04 : 0x74)) {
+                    moves = movegen_castles(p, moves, from);
+                }
+                break;
+        }
+    }
+    return moves - start;
+}
+
+/*-----------------------------------------------------------------------*/
+bool movegen_in_check(const position_t *p) {
+    return movegen_attacked(p, p->king[p->side], p->side ^ 1);
+}
+
+/*-----------------------------------------------------------------------*/
+// Returns false, with the position as it was, if the move leaves the king
+// in check
+bool movegen_make(position_t *p, const move_t *m, undo_t *u) {
+    uint8_t side = p->side;
+    uint8_t piece = p->board[m->from];
+
+    u->captured = p->board[m->to];
+    u->castle = p->castle;
+    u->ep = p->ep;
+
+    p->board[m->to] = m->promote ? m->promote | (piece & PIECE_WHITE) : piece;
+    p->board[m->from] = NONE;
+    if (m->flags & MOVEGEN_EN_PASSANT) {
+        // The captured pawn is beside the from square
+        p->board[MOVEGEN_SQUARE(MOVEGEN_RANK(m->from), MOVEGEN_FILE(m->to))] = NONE;
+    } else if (m->flags & MOVEGEN_CASTLE) {
+        if (m->to > m->from) {
+            p->board[m->from + 1] = p->board[m->from + 3];
+            p->board[m->from + 3] = NONE;
+        } else {
+            p->board[m->from - 1] = p->board[m->from - 4];
+            p->board[m->from - 4] = NONE;
+        }
+    }
+    if ((piece & ~PIECE_WHITE) == KING) {
+        p->king[side] = m->to;
+    }
+    p->ep = m->flags & MOVEGEN_DOUBLE_PUSH ? (m->from + m->to) >> 1 : MOVEGEN_NO_SQUARE;
+    if (p->castle) {
+        p->castle &= ~(movegen_castle_lost(m->from) | movegen_castle_lost(m->to));
+    }
+    p->side = side ^ 1;
+
+    if (movegen_attacked(p, p->king[side], side ^ 1)) {
+        movegen_unmake(p, m, u);
+        return false;
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+// Coordinate notation, ie e2e4 or e7e8q.  Returns the length
+uint8_t movegen_move_text(const move_t *m, char *text) {
+    char *start = text;
+
+    *text++ = 0x61 + MOVEGEN_FILE(m->from);     // 'a'
+    *text++ = 0x31 + MOVEGEN_RANK(m->from);     // '1'
+    *text++ = 0x61 + MOVEGEN_FILE(m->to);
+    *text++ = 0x31 + MOVEGEN_RANK(m->to);
+    if (m->promote) {
+        *text++ = movegen_letters[m->promote];
+    }
+    *text = '\0';
+    return text - start;
+}
+
+/*-----------------------------------------------------------------------*/
+// squares is 64 FEN letters, a8 first, with '-' for empty, the way
+// global.state.chess_board holds them.  White is to move with no castling
+// or en passant, so set those after.  The server's boards, wild ones too,
+// can be anything, so false if movegen can't work on it - a side without
+// exactly one king, or a pawn on the first or last rank
+bool movegen_set_board(position_t *p, const char *squares) {
+    uint8_t kings[2] = {0, 0};
+    bool valid = true;
+    uint8_t i, square, piece;
+
+    memset(p, 0, sizeof(position_t));
+    p->side = SIDE_WHITE;
+    p->ep = MOVEGEN_NO_SQUARE;
+    for (i = 0; i < 64; i++) {
+        square = MOVEGEN_SQUARE(7 - (i >> 3), i & 7);
+        piece = movegen_letter_to_piece(squares[i]);
+        p->board[square] = piece;
+        if ((piece & ~PIECE_WHITE) == KING) {
+            p->king[MOVEGEN_SIDE(piece)] = square;
+            kings[MOVEGEN_SIDE(piece)]++;
+        } else if ((piece & ~PIECE_WHITE) == PAWN && (i < 8 || i >= 56)) {
+            valid = false;
+        }
+    }
+    return valid && kings[SIDE_WHITE] == 1 && kings[SIDE_BLACK] == 1;
+}
+
+/*-----------------------------------------------------------------------*/
+// The placement, side, castling and en passant fields.  The move counters,
+// if there, are ignored
+bool movegen_set_fen(position_t *p, const char *fen) {
+    char squares[64];
+    uint8_t i = 0;
+    char c;
+
+    while ((c = *fen++) != '\x20') {            // ' '
+        if (!c) {
+            return false;
+        }
+        if (c >= '\x31' && c <= '\x38') {       // '1'..'8'
+            for (c -= 0x30; c && i < 64; c--) {
+                squares[i++] = '\x2d';          // '-'
+            }
+        } else if (c != '\x2f' && i < 64) {     // '/'
+            squares[i++] = c;
+        }
+    }
+    if (i != 64 || !movegen_set_board(p, squares)) {
+        return false;
+    }
+
+    p->side = *fen == '\x77' ? SIDE_WHITE : SIDE_BLACK;     // 'w'
+    fen += 2;
+    while ((c = *fen++) != '\x20') {            // ' '
+        switch (c) {
+            case '\x4b': p->castle |= MOVEGEN_CASTLE_WK; break;    // 'K'
+            case '\x51': p->castle |= MOVEGEN_CASTLE_WQ; break;    // 'Q'
+            case '\x6b': p->castle |= MOVEGEN_CASTLE_BK; break;    // 'k'
+            case '\x71': p->castle |= MOVEGEN_CASTLE_BQ; break;    // 'q'
+            case '\x2d': break;                                     // '-'
+            case '\0': return true;
+            default: return false;
+        }
+    }
+    if (*fen != '\x2d') {                       // '-'
+        p->ep = MOVEGEN_SQUARE(fen[1] - 0x31, fen[0] - 0x61);
+    }
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+// A style 12 board, with the side to move, castling and en passant from the
+// frame that came with it.  False, as movegen_set_board, if it can't be used
+bool movegen_set_frame(position_t *p, const char *squares, const struct _frame *frame) {
+    char ep = frame->double_pawn_push[0];
+    bool valid = movegen_set_board(p, squares);
+
+    p->side = *frame->color_to_move == '\x57' ? SIDE_WHITE : SIDE_BLACK;  // 'W'
+    // '1'
+    p->castle = (frame->w_can_castle_s[0] == '\x31' ? MOVEGEN_CASTLE_WK : 0) |
+                (frame->w_can_castle_l[0] == '\x31' ? MOVEGEN_CASTLE_WQ : 0) |
+                (frame->b_can_castle_s[0] == '\x31' ? MOVEGEN_CASTLE_BK : 0) |
+                (frame->b_can_castle_l[0] == '\x31' ? MOVEGEN_CASTLE_BQ : 0);
+    // The file of a pawn that just moved 2, or -1
+    if (ep >= '\x30' && ep <= '\x37') {     // '0'..'7'
+        p->ep = MOVEGEN_SQUARE(p->side == SIDE_WHITE ? 5 : 2, ep - 0x30);
+    }
+    return valid;
+}
+
+/*-----------------------------------------------------------------------*/
+void movegen_unmake(position_t *p, const move_t *m, const undo_t *u) {
+    uint8_t side = p->side ^ 1;
+    uint8_t piece = p->board[m->to];
+
+    if (m->promote) {
+        piece = PAWN | (piece & PIECE_WHITE);
+    }
+    p->board[m->from] = piece;
+    p->board[m->to] = u->captured;
+    if (m->flags & MOVEGEN_EN_PASSANT) {
+        p->board[MOVEGEN_SQUARE(MOVEGEN_RANK(m->from), MOVEGEN_FILE(m->to))] = PAWN | (side ? 0 : PIECE_WHITE);
+    } else if (m->flags & MOVEGEN_CASTLE) {
+        if (m->to > m->from) {
+            p->board[m->from + 3] = p->board[m->from + 1];
+            p->board[m->from + 1] = NONE;
+        } else {
+            p->board[m->from - 4] = p->board[m->from - 1];
+            p->board[m->from - 1] = NONE;
+        }
+    }
+    if ((piece & ~PIECE_WHITE) == KING) {
+        p->king[side] = m->from;
+    }
+    p->castle = u->castle;
+    p->ep = u->ep;
+    p->side = side;
+}
@@ -0,0 +1,76 @@
+/*
+ *  movegen.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#ifndef _MOVEGEN_H_
+#define _MOVEGEN_H_
+
+// The board is 0x88 - a square is rank * 16 + file, with a1 = 0x00 and
+// h8 = 0x77.  A square with 0x88 set is off the board, so a step off an edge
+// is a single test, and no 64 bit maths is needed, which cc65 doesn't have.
+// Squares hold the piece enum, | PIECE_WHITE for white, or NONE
+#define MOVEGEN_SQUARES         128
+#define MOVEGEN_NO_SQUARE       0x80
+#define MOVEGEN_OFF_BOARD(sq)   ((sq) & 0x88)
+#define MOVEGEN_SQUARE(rank, file)  (((rank) << 4) | (file))
+#define MOVEGEN_RANK(sq)        ((sq) >> 4)
+#define MOVEGEN_FILE(sq)        ((sq) & 7)
+#define MOVEGEN_SIDE(piece)     ((piece) >> 7)          // SIDE_WHITE or SIDE_BLACK
+
+// Room for the moves movegen_generate makes.  No position has more than 218
+// legal moves, and the ones that leave the king in check don't take it to 256
+#define MOVEGEN_MAX_MOVES       256
+
+// position_t castle
+#define MOVEGEN_CASTLE_WK       0x01
+#define MOVEGEN_CASTLE_WQ       0x02
+#define MOVEGEN_CASTLE_BK       0x04
+#define MOVEGEN_CASTLE_BQ       0x08
+
+// move_t flags
+#define MOVEGEN_CAPTURE         0x01
+#define MOVEGEN_DOUBLE_PUSH     0x02
+#define MOVEGEN_EN_PASSANT      0x04
+#define MOVEGEN_CASTLE          0x08
+
+// global.h has the style 12 frame
+struct _frame;
+
+typedef struct _position {
+    uint8_t board[MOVEGEN_SQUARES];
+    uint8_t side;                   // To move, SIDE_WHITE or SIDE_BLACK
+    uint8_t castle;                 // MOVEGEN_CASTLE_* still allowed
+    uint8_t ep;                     // Where a pawn can capture en passant, or MOVEGEN_NO_SQUARE
+    uint8_t king[2];                // Square of each side's king
+} position_t;
+
+typedef struct _move {
+    uint8_t from;
+    uint8_t to;
+    uint8_t promote;                // Piece the pawn becomes (no color), or NONE
+    uint8_t flags;                  // MOVEGEN_CAPTURE etc.
+} move_t;
+
+// What movegen_unmake needs to put back
+typedef struct _undo {
+    uint8_t captured;               // Piece that was on move.to
+    uint8_t castle;
+    uint8_t ep;
+} undo_t;
+
+bool movegen_attacked(const position_t *p, uint8_t square, uint8_t by_side);
+uint8_t movegen_generate(const position_t *p, move_t *moves);
+bool movegen_in_check(const position_t *p);
+bool movegen_make(position_t *p, const move_t *m, undo_t *u);
+uint8_t movegen_move_text(const move_t *m, char *text);
+bool movegen_set_board(position_t *p, const char *squares);
+bool movegen_set_fen(position_t *p, const char *fen);
+bool movegen_set_frame(position_t *p, const char *squares, const struct _frame *frame);
+void movegen_unmake(position_t *p, const move_t *m, const undo_t *u);
+
+#endif // _MOVEGEN_H_
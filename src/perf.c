@@ -0,0 +1,259 @@
+/*
+ *  perf.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "global.h"
+
+// Only in the RETROMATE_PERF builds.  Frame phase timings, kept in
+// histograms, and counters.  RETROMATE_PERF_FILE=name writes them, as JSON,
+// when the program ends.  RETROMATE_TRACE_FILE=name writes the spans as a
+// Chrome trace (load it in chrome://tracing or ui.perfetto.dev)
+
+perf_t perf;
+
+const char *perf_counter_names[PERF_COUNTERS] = {
+    "bytes_received",
+    "bytes_sent",
+    "tcp_recv_calls",
+    "style12_frames",
+    "style12_unchanged",
+    "text_textures",
+    "log_lines",
+};
+
+const char *perf_phase_names[PERF_PHASES] = {
+    "key_input",
+    "app_draw",
+    "menu_tick",
+    "app_tick",
+    "net_update",
+    "plat_draw",
+    "frame",
+};
+
+const char *perf_span_names[PERF_SPANS] = {
+    "recv",
+    "style12",
+    "board",
+    "present",
+    "move_to_screen",
+    "input_to_send",
+};
+
+/*-----------------------------------------------------------------------*/
+// Below 4us, a bucket a microsecond.  After that 4 buckets per doubling
+static uint8_t perf_bucket(uint32_t us) {
+    uint8_t octave = 0;
+    uint32_t top = us;
+
+    if (us < 4) {
+        return us;
+    }
+    while (top >= 8) {
+        top >>= 1;
+        octave++;
+    }
+    // top is now 4..7, so the 2 bits under the leading 1 pick the bucket
+    return MIN(PERF_BUCKETS - 1, 4 + octave * 4 + (top & 3));
+}
+
+/*-----------------------------------------------------------------------*/
+// The largest time that lands in bucket
+static uint32_t perf_bucket_top(uint8_t bucket) {
+    uint8_t octave;
+
+    if (bucket < 4) {
+        return bucket;
+    }
+    octave = (bucket - 4) / 4;
+    return (((uint32_t)(4 + (bucket & 3)) + 1) << octave) - 1;
+}
+
+/*-----------------------------------------------------------------------*/
+static void perf_record(perf_histogram_t *h, uint64_t ticks) {
+    uint32_t us = (uint32_t)(ticks * 1000000 / perf.frequency);
+
+    h->buckets[perf_bucket(us)]++;
+    h->samples++;
+    h->last_us = us;
+    h->total_us += us;
+    if (us > h->max_us) {
+        h->max_us = us;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+static void perf_dump_histograms(FILE *fp, const char *title, perf_histogram_t *h, const char **names, uint8_t count) {
+    uint8_t i;
+
+    fprintf(fp, "  \"%s\": {\n", title);
+    for (i = 0; i < count; i++, h++) {
+        fprintf(fp, "    \"%s\": {\"samples\": %u, \"mean\": %llu, \"p50\": %u, \"p99\": %u, \"max\": %u}%s\n",
+                names[i],
+                h->samples,
+                (unsigned long long)(h->samples ? h->total_us / h->samples : 0),
+                perf_percentile(h, 50),
+                perf_percentile(h, 99),
+                h->max_us,
+                i < count - 1 ? "," : "");
+    }
+    fprintf(fp, "  },\n");
+}
+
+/*-----------------------------------------------------------------------*/
+static void perf_event(uint8_t span, uint64_t start) {
+    perf_event_t *e = &perf.events[perf.event_head];
+
+    e->span = span;
+    e->start = start;
+    e->end = plat_core_perf_ticks();
+    perf_record(&perf.spans[span], e->end - start);
+    e->textures = perf.counters[PERF_TEXT_TEXTURES] - perf.span_textures[span];
+    if (++perf.event_head >= PERF_TRACE_EVENTS) {
+        perf.event_head = 0;
+    }
+    if (perf.event_count < PERF_TRACE_EVENTS) {
+        perf.event_count++;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+static double perf_trace_us(uint64_t ticks) {
+    return (double)(ticks - perf.epoch) * 1000000.0 / perf.frequency;
+}
+
+/*-----------------------------------------------------------------------*/
+// Complete ("X") events, oldest first, on one track
+static void perf_dump_trace(void) {
+    const char *name = getenv("RETROMATE_TRACE_FILE");
+    FILE *fp;
+    uint16_t i, index;
+
+    if (!name || !(fp = fopen(name, "w"))) {
+        return;
+    }
+    fprintf(fp, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+    index = (perf.event_head + PERF_TRACE_EVENTS - perf.event_count) % PERF_TRACE_EVENTS;
+    for (i = 0; i < perf.event_count; i++) {
+        perf_event_t *e = &perf.events[index];
+        fprintf(fp, "{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f, \"args\": {\"textures\": %u}}%s\n",
+                perf_span_names[e->span],
+                // The move and input spans overlap the others, so get their own tracks
+                e->span == PERF_SPAN_MOVE ? 2 : e->span == PERF_SPAN_INPUT ? 3 : 1,
+                perf_trace_us(e->start),
+                perf_trace_us(e->end) - perf_trace_us(e->start),
+                e->textures,
+                i < perf.event_count - 1 ? "," : "");
+        if (++index >= PERF_TRACE_EVENTS) {
+            index = 0;
+        }
+    }
+    fprintf(fp, "]}\n");
+    fclose(fp);
+}
+
+/*-----------------------------------------------------------------------*/
+void perf_dump(void) {
+    const char *name = getenv("RETROMATE_PERF_FILE");
+    FILE *fp;
+    uint8_t i;
+
+    perf_dump_trace();
+    if (!name || !(fp = fopen(name, "w"))) {
+        return;
+    }
+    fprintf(fp, "{\n");
+    perf_dump_histograms(fp, "phases_us", perf.phases, perf_phase_names, PERF_PHASES);
+    perf_dump_histograms(fp, "spans_us", perf.spans, perf_span_names, PERF_SPANS);
+    fprintf(fp, "  \"counters\": {\n");
+    for (i = 0; i < PERF_COUNTERS; i++) {
+        fprintf(fp, "    \"%s\": %llu%s\n", perf_counter_names[i], (unsigned long long)perf.counters[i], i < PERF_COUNTERS - 1 ? "," : "");
+    }
+    fprintf(fp, "  }\n}\n");
+    fclose(fp);
+}
+
+/*-----------------------------------------------------------------------*/
+void perf_init(void) {
+    memset(&perf, 0, sizeof(perf));
+    perf.frequency = plat_core_perf_frequency();
+    perf.epoch = perf.frame_start = perf.last_mark = plat_core_perf_ticks();
+}
+
+/*-----------------------------------------------------------------------*/
+void perf_mark(uint8_t phase) {
+    uint64_t now = plat_core_perf_ticks();
+
+    perf_record(&perf.phases[phase], now - perf.last_mark);
+    perf.last_mark = now;
+    if (phase == PERF_PLAT_DRAW) {
+        perf_record(&perf.phases[PERF_FRAME], now - perf.frame_start);
+        perf.frame_start = now;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// A <12> starts the move span at the receive that brought it, unless an
+// earlier move is still on its way.  Shown only closes it once the board
+// was drawn after the parse
+void perf_move(uint8_t stage) {
+    switch (stage) {
+        case PERF_MOVE_PARSED:
+            if (!perf.span_start[PERF_SPAN_MOVE]) {
+                perf.span_start[PERF_SPAN_MOVE] = perf.span_start[PERF_SPAN_RECV];
+                perf.span_textures[PERF_SPAN_MOVE] = perf.counters[PERF_TEXT_TEXTURES];
+            }
+            break;
+
+        case PERF_MOVE_DRAWN:
+            perf.move_drawn = perf.span_start[PERF_SPAN_MOVE] != 0;
+            break;
+
+        case PERF_MOVE_SHOWN:
+            if (perf.move_drawn) {
+                perf_event(PERF_SPAN_MOVE, perf.span_start[PERF_SPAN_MOVE]);
+                perf.span_start[PERF_SPAN_MOVE] = 0;
+                perf.move_drawn = false;
+            }
+            break;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// The time percent of the samples were at or under, to the bucket's accuracy
+uint32_t perf_percentile(perf_histogram_t *h, uint8_t percent) {
+    uint32_t want = ((uint64_t)h->samples * percent + 99) / 100;
+    uint32_t seen = 0;
+    uint8_t i;
+
+    if (!h->samples) {
+        return 0;
+    }
+    for (i = 0; i < PERF_BUCKETS; i++) {
+        seen += h->buckets[i];
+        if (seen >= want) {
+            return MIN(perf_bucket_top(i), h->max_us);
+        }
+    }
+    return h->max_us;
+}
+
+/*-----------------------------------------------------------------------*/
+void perf_span_begin(uint8_t span) {
+    perf.span_start[span] = plat_core_perf_ticks();
+    perf.span_textures[span] = perf.counters[PERF_TEXT_TEXTURES];
+}
+
+/*-----------------------------------------------------------------------*/
+void perf_span_end(uint8_t span) {
+    perf_event(span, perf.span_start[span]);
+}
@@ -0,0 +1,123 @@
+/*
+ *  perf.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#ifndef _PERF_H_
+#define _PERF_H_
+
+// The parts of a main loop frame.  Each PERF_MARK times from the one before
+enum {
+    PERF_KEY_INPUT,                 // plat_core_key_input
+    PERF_APP_DRAW,                  // app_draw_update
+    PERF_MENU_TICK,                 // menu_tick
+    PERF_APP_TICK,                  // global.app.tick
+    PERF_NET_UPDATE,                // plat_net_update
+    PERF_PLAT_DRAW,                 // plat_draw_update, the last in a frame
+    PERF_FRAME,                     // All of the above
+    PERF_PHASES,
+};
+
+enum {
+    PERF_BYTES_RECEIVED,
+    PERF_BYTES_SENT,
+    PERF_TCP_RECV_CALLS,            // fics_tcp_recv
+    PERF_STYLE12_FRAMES,            // <12> lines parsed
+    PERF_STYLE12_UNCHANGED,         // <12> lines with the position already shown
+    PERF_TEXT_TEXTURES,             // Made by plat_draw_text
+    PERF_LOG_LINES,                 // Lines copied into a log
+    PERF_COUNTERS,
+};
+
+// The trace spans.  PERF_SPAN_MOVE is from the receive that brought a <12>
+// to the present that first showed the board drawn from it
+enum {
+    PERF_SPAN_RECV,                 // fics_tcp_recv, from plat_net_update
+    PERF_SPAN_STYLE12,              // Parsing one <12> line
+    PERF_SPAN_BOARD,                // The board refresh in app_draw_update
+    PERF_SPAN_PRESENT,              // Putting the frame on screen (vsync)
+    PERF_SPAN_MOVE,
+    PERF_SPAN_INPUT,                // The select that makes a move, to its send
+    PERF_SPANS,
+};
+
+// Where a move is, on its way to the screen
+enum {
+    PERF_MOVE_PARSED,
+    PERF_MOVE_DRAWN,
+    PERF_MOVE_SHOWN,
+};
+
+#ifdef RETROMATE_PERF
+
+// 4 buckets per doubling, in microseconds, so 0us to 131ms.  Slower lands in
+// the last bucket
+#define PERF_BUCKETS            64
+// The last this many spans are kept for the trace
+#define PERF_TRACE_EVENTS       8192
+
+typedef struct _perf_histogram {
+    uint32_t buckets[PERF_BUCKETS];
+    uint32_t samples;
+    uint32_t last_us;
+    uint32_t max_us;
+    uint64_t total_us;
+} perf_histogram_t;
+
+typedef struct _perf_event {
+    uint64_t start;                 // plat_core_perf_ticks
+    uint64_t end;
+    uint32_t textures;              // Made by plat_draw_text in the span
+    uint8_t span;
+} perf_event_t;
+
+typedef struct _perf {
+    uint64_t frequency;             // plat_core_perf_ticks per second
+    uint64_t epoch;                 // Trace time 0
+    uint64_t frame_start;
+    uint64_t last_mark;
+    perf_histogram_t phases[PERF_PHASES];
+    perf_histogram_t spans[PERF_SPANS];
+    uint64_t counters[PERF_COUNTERS];
+    uint64_t span_start[PERF_SPANS];
+    uint64_t span_textures[PERF_SPANS];
+    bool move_drawn;                // The board showing PERF_SPAN_MOVE is drawn
+    uint16_t event_head;
+    uint16_t event_count;
+    perf_event_t events[PERF_TRACE_EVENTS];
+} perf_t;
+
+extern perf_t perf;
+extern const char *perf_counter_names[PERF_COUNTERS];
+extern const char *perf_phase_names[PERF_PHASES];
+extern const char *perf_span_names[PERF_SPANS];
+
+#define PERF_COUNT(counter, n)  perf.counters[counter] += (n)
+#define PERF_MARK(phase)        perf_mark(phase)
+#define PERF_MOVE(stage)        perf_move(stage)
+#define PERF_SPAN_BEGIN(span)   perf_span_begin(span)
+#define PERF_SPAN_END(span)     perf_span_end(span)
+
+void perf_dump(void);
+void perf_init(void);
+void perf_mark(uint8_t phase);
+void perf_move(uint8_t stage);
+uint32_t perf_percentile(perf_histogram_t *h, uint8_t percent);
+void perf_span_begin(uint8_t span);
+void perf_span_end(uint8_t span);
+
+#else
+
+#define PERF_COUNT(counter, n)
+#define PERF_MARK(phase)
+#define PERF_MOVE(stage)
+#define PERF_SPAN_BEGIN(span)
+#define PERF_SPAN_END(span)
+
+#endif
+
+#endif //_PERF_H_
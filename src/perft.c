@@ -0,0 +1,206 @@
+/*
+ *  perft.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#ifndef __CC65__
+#include <time.h>
+#endif
+
+#include "global.h"
+
+#ifdef __SIM6502__
+#include "sim65/platSim65.h"
+#endif
+
+// Counts the moves movegen.c makes from standard positions, to fixed depths,
+// and checks them against the known counts.  retromate_perft runs it on the
+// build machine, and reports nodes per second.  sim6502_perft runs it in
+// sim65, and reports 6502 cycles per node
+
+#define PERFT_DEPTH_MAX         5
+
+typedef struct _perft_position {
+    const char *name;
+    const char *fen;                            // ASCII, so hex (see fics.c)
+    uint32_t nodes[PERFT_DEPTH_MAX];            // Known counts at depth 1 on, 0 if not listed
+    uint8_t depth;                              // How deep retromate_perft goes
+    uint8_t depth_6502;                         // How deep sim6502_perft goes
+} perft_position_t;
+
+// From the Chess Programming Wiki's perft results page
+static const perft_position_t perft_positions[] = {
+    {
+        "start",
+        // "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"
+        "\x72\x6e\x62\x71\x6b\x62\x6e\x72\x2f\x70\x70\x70\x70\x70\x70\x70"
+        "\x70\x2f\x38\x2f\x38\x2f\x38\x2f\x38\x2f\x50\x50\x50\x50\x50\x50"
+        "\x50\x50\x2f\x52\x4e\x42\x51\x4b\x42\x4e\x52\x20\x77\x20\x4b\x51"
+        "\x6b\x71\x20\x2d\x20\x30\x20\x31",
+        {20, 400, 8902, 197281, 4865609},
+        5,                                      // depth
+        3,                                      // depth_6502
+    },
+    {
+        "kiwipete",
+        // "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"
+        "\x72\x33\x6b\x32\x72\x2f\x70\x31\x70\x70\x71\x70\x62\x31\x2f\x62"
+        "\x6e\x32\x70\x6e\x70\x31\x2f\x33\x50\x4e\x33\x2f\x31\x70\x32\x50"
+        "\x33\x2f\x32\x4e\x32\x51\x31\x70\x2f\x50\x50\x50\x42\x42\x50\x50"
+        "\x50\x2f\x52\x33\x4b\x32\x52\x20\x77\x20\x4b\x51\x6b\x71\x20\x2d"
+        "\x20\x30\x20\x31",
+        {48, 2039, 97862, 4085603, 0},
+        4,                                      // depth
+        2,                                      // depth_6502
+    },
+    {
+        "position 3",
+        // "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"
+        "\x38\x2f\x32\x70\x35\x2f\x33\x70\x34\x2f\x4b\x50\x35\x72\x2f\x31"
+        "\x52\x33\x70\x31\x6b\x2f\x38\x2f\x34\x50\x31\x50\x31\x2f\x38\x20"
+        "\x77\x20\x2d\x20\x2d\x20\x30\x20\x31",
+        {14, 191, 2812, 43238, 674624},
+        5,                                      // depth
+        4,                                      // depth_6502
+    },
+    {
+        "position 4",
+        // "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"
+        "\x72\x33\x6b\x32\x72\x2f\x50\x70\x70\x70\x31\x70\x70\x70\x2f\x31"
+        "\x62\x33\x6e\x62\x4e\x2f\x6e\x50\x36\x2f\x42\x42\x50\x31\x50\x33"
+        "\x2f\x71\x34\x4e\x32\x2f\x50\x70\x31\x50\x32\x50\x50\x2f\x52\x32"
+        "\x51\x31\x52\x4b\x31\x20\x77\x20\x6b\x71\x20\x2d\x20\x30\x20\x31",
+        {6, 264, 9467, 422333, 0},
+        4,                                      // depth
+        3,                                      // depth_6502
+    },
+    {
+        "position 5",
+        // "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8"
+        "\x72\x6e\x62\x71\x31\x6b\x31\x72\x2f\x70\x70\x31\x50\x62\x70\x70"
+        "\x70\x2f\x32\x70\x35\x2f\x38\x2f\x32\x42\x35\x2f\x38\x2f\x50\x50"
+        "\x50\x31\x4e\x6e\x50\x50\x2f\x52\x4e\x42\x51\x4b\x32\x52\x20\x77"
+        "\x20\x4b\x51\x20\x2d\x20\x31\x20\x38",
+        {44, 1486, 62379, 2103487, 0},
+        4,                                      // depth
+        2,                                      // depth_6502
+    },
+    {
+        "position 6",
+        // "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10"
+        "\x72\x34\x72\x6b\x31\x2f\x31\x70\x70\x31\x71\x70\x70\x70\x2f\x70"
+        "\x31\x6e\x70\x31\x6e\x32\x2f\x32\x62\x31\x70\x31\x42\x31\x2f\x32"
+        "\x42\x31\x50\x31\x62\x31\x2f\x50\x31\x4e\x50\x31\x4e\x32\x2f\x31"
+        "\x50\x50\x31\x51\x50\x50\x50\x2f\x52\x34\x52\x4b\x31\x20\x77\x20"
+        "\x2d\x20\x2d\x20\x30\x20\x31\x30",
+        {46, 2079, 89890, 3894594, 0},
+        4,                                      // depth
+        2,                                      // depth_6502
+    },
+};
+
+// The moves of each depth.  Not on the stack, which cc65 keeps small
+static move_t perft_moves[PERFT_DEPTH_MAX][MOVEGEN_MAX_MOVES];
+static position_t perft_position;
+
+#ifdef __SIM6502__
+/*-----------------------------------------------------------------------*/
+static uint32_t perft_cycles(void) {
+    SIM65_COUNTER_LATCH = 0;
+    SIM65_COUNTER_LATCH = 1;
+    return SIM65_COUNTER_VALUE;
+}
+#endif
+
+/*-----------------------------------------------------------------------*/
+static uint32_t perft(uint8_t depth) {
+    move_t *m = perft_moves[depth - 1];
+    uint8_t count = movegen_generate(&perft_position, m);
+    uint32_t nodes = 0;
+    undo_t u;
+
+    for (; count; count--, m++) {
+        if (movegen_make(&perft_position, m, &u)) {
+            nodes += depth > 1 ? perft(depth - 1) : 1;
+            movegen_unmake(&perft_position, m, &u);
+        }
+    }
+    return nodes;
+}
+
+/*-----------------------------------------------------------------------*/
+// retromate_perft [depth] goes to depth, or the deepest known count below it,
+// for every position.  The exit code is the number that failed
+int main(int argc, char *argv[]) {
+    const perft_position_t *pp;
+    uint8_t i, depth;
+    uint8_t failures = 0;
+    uint32_t nodes, total = 0;
+#ifdef __SIM6502__
+    uint32_t start, cycles, total_cycles = 0;
+
+    UNUSED(argc);
+    UNUSED(argv);
+    SIM65_COUNTER_SELECT = SIM65_COUNTER_CYCLES;
+#else
+    clock_t start;
+    double seconds, total_seconds = 0;
+#endif
+
+    for (i = 0; i < AS(perft_positions); i++) {
+        pp = &perft_positions[i];
+#ifdef __SIM6502__
+        depth = pp->depth_6502;
+#else
+        depth = argc > 1 ? atoi(argv[1]) : pp->depth;
+        if (depth > PERFT_DEPTH_MAX) {
+            depth = PERFT_DEPTH_MAX;
+        }
+        while (depth > 1 && !pp->nodes[depth - 1]) {
+            depth--;
+        }
+#endif
+        if (!depth || !movegen_set_fen(&perft_position, pp->fen)) {
+            printf("%-10s bad FEN or depth\n", pp->name);
+            failures++;
+            continue;
+        }
+
+#ifdef __SIM6502__
+        start = perft_cycles();
+        nodes = perft(depth);
+        cycles = perft_cycles() - start;
+        total_cycles += cycles;
+        printf("%-10s %u %9lu %s %6lu cycles/node\n", pp->name, depth, (unsigned long)nodes,
+               nodes == pp->nodes[depth - 1] ? "ok  " : "FAIL", (unsigned long)(cycles / nodes));
+#else
+        start = clock();
+        nodes = perft(depth);
+        seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+        total_seconds += seconds;
+        printf("%-10s %u %9lu %s %7.3fs %12.0f nodes/s\n", pp->name, depth, (unsigned long)nodes,
+               nodes == pp->nodes[depth - 1] ? "ok  " : "FAIL", seconds, seconds > 0 ? nodes / seconds : 0.0);
+#endif
+        if (nodes != pp->nodes[depth - 1]) {
+            printf("%-10s expected %lu\n", "", (unsigned long)pp->nodes[depth - 1]);
+            failures++;
+        }
+        total += nodes;
+    }
+
+#ifdef __SIM6502__
+    // At 1MHz, cycles per node is microseconds per node
+    printf("%lu nodes, %lu cycles/node, %lu nodes/s at 1MHz\n", (unsigned long)total,
+           (unsigned long)(total_cycles / total), (unsigned long)(1000000UL / (total_cycles / total)));
+#else
+    printf("%lu nodes, %.0f nodes/s\n", (unsigned long)total, total_seconds > 0 ? total / total_seconds : 0.0);
+#endif
+    printf("%u failed\n", failures);
+    return failures;
+}
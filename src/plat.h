@@ -20,11 +20,16 @@ extern uint8_t plat_mc2pc[9];
 
 // Core
 void plat_core_active_term(bool active);
+bool plat_core_config_load(void *data, uint8_t size);   // False if there's none
+void plat_core_config_save(const void *data, uint8_t size);
 void plat_core_copy_ascii_to_display(void *dest, const void *src, size_t n);
 void plat_core_exit(void);
 uint8_t plat_core_get_cols(void);
 uint8_t plat_core_get_rows(void);
 uint8_t plat_core_get_status_x(void);
+const char *plat_core_history_get(uint16_t slot);
+uint16_t plat_core_history_init(void);  // Rows of LOG_HISTORY_COLS it can keep, 0 for none
+void plat_core_history_put(uint16_t slot, const char *row);
 void plat_core_init(void);
 uint8_t plat_core_key_input(input_event_t *evt);
 void plat_core_key_wait_any(void);
@@ -34,6 +39,34 @@ uint8_t plat_core_mouse_to_cursor(void);
 uint8_t plat_core_mouse_to_menu_item(void);
 void plat_core_shutdown(void);
 uint8_t plat_draw_ui_help_callback(menu_t *m, void *data);
+#ifdef RETROMATE_BENCH
+void plat_core_bench_start(void);
+uint32_t plat_core_bench_cycles(void);  // Since plat_core_bench_start
+#endif
+#ifdef RETROMATE_PERF
+uint64_t plat_core_perf_frequency(void);
+uint64_t plat_core_perf_ticks(void);
+#endif
+#ifdef RETROMATE_ENGINE
+// engine_search runs on a thread of its own.  The search thread calls poll
+// and publish, the main thread the rest
+bool plat_core_engine_poll(void);       // True when the search must stop
+void plat_core_engine_publish(const engine_result_t *result);
+bool plat_core_engine_result(engine_result_t *result);  // A new result for the last start
+void plat_core_engine_start(const position_t *position);
+void plat_core_engine_stop(void);
+#endif
+#ifdef RETROMATE_ARCHIVE
+// Appends are queued, and written and synced on another thread, in order.
+// Flush waits for the queue to empty
+void plat_core_file_append(const char *path, const uint8_t *data, uint32_t size);
+void plat_core_file_flush(void);
+void plat_core_file_truncate(const char *path, uint32_t size);     // Before any append
+#endif
+#if defined(RETROMATE_BOOK) || defined(RETROMATE_ARCHIVE)
+const uint8_t *plat_core_file_map(const char *path, uint32_t *size);    // NULL if it can't
+void plat_core_file_unmap(const uint8_t *data, uint32_t size);
+#endif
 
 // Draw
 void plat_draw_background(void);
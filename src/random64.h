@@ -0,0 +1,411 @@
+/*
+ *  random64.h
+ *  RetroMate
+ *
+ *  Polyglot's Random64 numbers, from the Polyglot book format, which is in
+ *  the public domain.  Split into hi and lo halves for zobrist_key_t.
+ *
+ */
+
+#ifndef _RANDOM64_H_
+#define _RANDOM64_H_
+
+static const zobrist_key_t zobrist_random64[ZOBRIST_KEYS] = {
+    // Pieces, 64 * kind + square
+    {0x9D39247EUL, 0x33776D41UL}, {0x2AF73980UL, 0x05AAA5C7UL},
+    {0x44DB0150UL, 0x24623547UL}, {0x9C15F73EUL, 0x62A76AE2UL},
+    {0x75834465UL, 0x489C0C89UL}, {0x3290AC3AUL, 0x203001BFUL},
+    {0x0FBBAD1FUL, 0x61042279UL}, {0xE83A908FUL, 0xF2FB60CAUL},
+    {0x0D7E765DUL, 0x58755C10UL}, {0x1A083822UL, 0xCEAFE02DUL},
+    {0x9605D5F0UL, 0xE25EC3B0UL}, {0xD021FF5CUL, 0xD13A2ED5UL},
+    {0x40BDF15DUL, 0x4A672E32UL}, {0x01135514UL, 0x6FD56395UL},
+    {0x5DB48320UL, 0x46F3D9E5UL}, {0x239F8B2DUL, 0x7FF719CCUL},
+    {0x05D1A1AEUL, 0x85B49AA1UL}, {0x679F848FUL, 0x6E8FC971UL},
+    {0x7449BBFFUL, 0x801FED0BUL}, {0x7D11CDB1UL, 0xC3B7ADF0UL},
+    {0x82C7709EUL, 0x781EB7CCUL}, {0xF3218F1CUL, 0x9510786CUL},
+    {0x331478F3UL, 0xAF51BBE6UL}, {0x4BB38DE5UL, 0xE7219443UL},
+    {0xAA649C6EUL, 0xBCFD50FCUL}, {0x8DBD98A3UL, 0x52AFD40BUL},
+    {0x87D2074BUL, 0x81D79217UL}, {0x19F3C751UL, 0xD3E92AE1UL},
+    {0xB4AB30F0UL, 0x62B19ABFUL}, {0x7B0500ACUL, 0x42047AC4UL},
+    {0xC9452CA8UL, 0x1A09D85DUL}, {0x24AA6C51UL, 0x4DA27500UL},
+    {0x4C9F3442UL, 0x7501B447UL}, {0x14A68FD7UL, 0x3C910841UL},
+    {0xA71B9B83UL, 0x461CBD93UL}, {0x03488B95UL, 0xB0F1850FUL},
+    {0x637B2B34UL, 0xFF93C040UL}, {0x09D1BC9AUL, 0x3DD90A94UL},
+    {0x35756683UL, 0x34A1DD3BUL}, {0x735E2B97UL, 0xA4C45A23UL},
+    {0x18727070UL, 0xF1BD400BUL}, {0x1FCBACD2UL, 0x59BF02E7UL},
+    {0xD310A7C2UL, 0xCE9B6555UL}, {0xBF983FE0UL, 0xFE5D8244UL},
+    {0x9F74D14FUL, 0x7454A824UL}, {0x51EBDC4AUL, 0xB9BA3035UL},
+    {0x5C82C505UL, 0xDB9AB0FAUL}, {0xFCF7FE8AUL, 0x3430B241UL},
+    {0x3253A729UL, 0xB9BA3DDEUL}, {0x8C74C368UL, 0x081B3075UL},
+    {0xB9BC6C87UL, 0x167C33E7UL}, {0x7EF48F2BUL, 0x83024E20UL},
+    {0x11D505D4UL, 0xC351BD7FUL}, {0x6568FCA9UL, 0x2C76A243UL},
+    {0x4DE0B0F4UL, 0x0F32A7B8UL}, {0x96D69346UL, 0x0CC37E5DUL},
+    {0x42E240CBUL, 0x63689F2FUL}, {0x6D2BDCDAUL, 0xE2919661UL},
+    {0x42880B02UL, 0x36E4D951UL}, {0x5F0F4A58UL, 0x98171BB6UL},
+    {0x39F890F5UL, 0x79F92F88UL}, {0x93C5B5F4UL, 0x7356388BUL},
+    {0x63DC359DUL, 0x8D231B78UL}, {0xEC16CA8AUL, 0xEA98AD76UL},
+    {0x5355F900UL, 0xC2A82DC7UL}, {0x07FB9F85UL, 0x5A997142UL},
+    {0x5093417AUL, 0xA8A7ED5EUL}, {0x7BCBC38DUL, 0xA25A7F3CUL},
+    {0x19FC8A76UL, 0x8CF4B6D4UL}, {0x637A7780UL, 0xDECFC0D9UL},
+    {0x8249A47AUL, 0xEE0E41F7UL}, {0x79AD6955UL, 0x01E7D1E8UL},
+    {0x14ACBAF4UL, 0x777D5776UL}, {0xF145B6BEUL, 0xCCDEA195UL},
+    {0xDABF2AC8UL, 0x201752FCUL}, {0x24C3C94DUL, 0xF9C8D3F6UL},
+    {0xBB6E2924UL, 0xF03912EAUL}, {0x0CE26C0BUL, 0x95C980D9UL},
+    {0xA49CD132UL, 0xBFBF7CC4UL}, {0xE99D662AUL, 0xF4243939UL},
+    {0x27E6AD78UL, 0x91165C3FUL}, {0x8535F040UL, 0xB9744FF1UL},
+    {0x54B3F4FAUL, 0x5F40D873UL}, {0x72B12C32UL, 0x127FED2BUL},
+    {0xEE954D3CUL, 0x7B411F47UL}, {0x9A85AC90UL, 0x9A24EAA1UL},
+    {0x70AC4CD9UL, 0xF04F21F5UL}, {0xF9B89D3EUL, 0x99A075C2UL},
+    {0x87B3E2B2UL, 0xB5C907B1UL}, {0xA366E5B8UL, 0xC54F48B8UL},
+    {0xAE4A9346UL, 0xCC3F7CF2UL}, {0x1920C04DUL, 0x47267BBDUL},
+    {0x87BF02C6UL, 0xB49E2AE9UL}, {0x092237ACUL, 0x237F3859UL},
+    {0xFF07F64EUL, 0xF8ED14D0UL}, {0x8DE8DCA9UL, 0xF03CC54EUL},
+    {0x9C163326UL, 0x4DB49C89UL}, {0xB3F22C3DUL, 0x0B0B38EDUL},
+    {0x390E5FB4UL, 0x4D01144BUL}, {0x5BFEA5B4UL, 0x712768E9UL},
+    {0x1E103291UL, 0x1FA78984UL}, {0x9A74ACB9UL, 0x64E78CB3UL},
+    {0x4F80F7A0UL, 0x35DAFB04UL}, {0x6304D09AUL, 0x0B3738C4UL},
+    {0x2171E646UL, 0x83023A08UL}, {0x5B9B63EBUL, 0x9CEFF80CUL},
+    {0x506AACF4UL, 0x89889342UL}, {0x1881AFC9UL, 0xA3A701D6UL},
+    {0x65030804UL, 0x40750644UL}, {0xDFD39533UL, 0x9CDBF4A7UL},
+    {0xEF927DBCUL, 0xF00C20F2UL}, {0x7B32F7D1UL, 0xE03680ECUL},
+    {0xB9FD7620UL, 0xE7316243UL}, {0x05A7E8A5UL, 0x7DB91B77UL},
+    {0xB5889C6EUL, 0x15630A75UL}, {0x4A750A09UL, 0xCE9573F7UL},
+    {0xCF464CECUL, 0x899A2F8AUL}, {0xF538639CUL, 0xE705B824UL},
+    {0x3C79A0FFUL, 0x5580EF7FUL}, {0xEDE6C87FUL, 0x8477609DUL},
+    {0x799E81F0UL, 0x5BC93F31UL}, {0x86536B8CUL, 0xF3428A8CUL},
+    {0x97D7374CUL, 0x60087B73UL}, {0xA246637CUL, 0xFF328532UL},
+    {0x043FCAE6UL, 0x0CC0EBA0UL}, {0x920E4495UL, 0x35DD359EUL},
+    {0x70EB093BUL, 0x15B290CCUL}, {0x73A19219UL, 0x16591CBDUL},
+    {0x56436C9FUL, 0xE1A1AA8DUL}, {0xEFAC4B70UL, 0x633B8F81UL},
+    {0xBB215798UL, 0xD45DF7AFUL}, {0x45F20042UL, 0xF24F1768UL},
+    {0x930F80F4UL, 0xE8EB7462UL}, {0xFF6712FFUL, 0xCFD75EA1UL},
+    {0xAE623FD6UL, 0x7468AA70UL}, {0xDD2C5BC8UL, 0x4BC8D8FCUL},
+    {0x7EED120DUL, 0x54CF2DD9UL}, {0x22FE5454UL, 0x01165F1CUL},
+    {0xC91800E9UL, 0x8FB99929UL}, {0x808BD68EUL, 0x6AC10365UL},
+    {0xDEC46814UL, 0x5B7605F6UL}, {0x1BEDE3A3UL, 0xAEF53302UL},
+    {0x43539603UL, 0xD6C55602UL}, {0xAA969B5CUL, 0x691CCB7AUL},
+    {0xA87832D3UL, 0x92EFEE56UL}, {0x65942C7BUL, 0x3C7E11AEUL},
+    {0xDED2D633UL, 0xCAD004F6UL}, {0x21F08570UL, 0xF420E565UL},
+    {0xB415938DUL, 0x7DA94E3CUL}, {0x91B859E5UL, 0x9ECB6350UL},
+    {0x10CFF333UL, 0xE0ED804AUL}, {0x28AED140UL, 0xBE0BB7DDUL},
+    {0xC5CC1D89UL, 0x724FA456UL}, {0x5648F680UL, 0xF11A2741UL},
+    {0x2D255069UL, 0xF0B7DAB3UL}, {0x9BC5A38EUL, 0xF729ABD4UL},
+    {0xEF2F0543UL, 0x08F6A2BCUL}, {0xAF2042F5UL, 0xCC5C2858UL},
+    {0x480412BAUL, 0xB7F5BE2AUL}, {0xAEF3AF4AUL, 0x563DFE43UL},
+    {0x19AFE59AUL, 0xE451497FUL}, {0x52593803UL, 0xDFF1E840UL},
+    {0xF4F076E6UL, 0x5F2CE6F0UL}, {0x11379625UL, 0x747D5AF3UL},
+    {0xBCE5D224UL, 0x8682C115UL}, {0x9DA4243DUL, 0xE836994FUL},
+    {0x066F70B3UL, 0x3FE09017UL}, {0x4DC4DE18UL, 0x9B671A1CUL},
+    {0x51039AB7UL, 0x712457C3UL}, {0xC07A3F80UL, 0xC31FB4B4UL},
+    {0xB46EE9C5UL, 0xE64A6E7CUL}, {0xB3819A42UL, 0xABE61C87UL},
+    {0x21A00793UL, 0x3A522A20UL}, {0x2DF16F76UL, 0x1598AA4FUL},
+    {0x763C4A13UL, 0x71B368FDUL}, {0xF793C467UL, 0x02E086A0UL},
+    {0xD7288E01UL, 0x2AEB8D31UL}, {0xDE336A2AUL, 0x4BC1C44BUL},
+    {0x0BF692B3UL, 0x8D079F23UL}, {0x2C604A7AUL, 0x177326B3UL},
+    {0x4850E73EUL, 0x03EB6064UL}, {0xCFC447F1UL, 0xE53C8E1BUL},
+    {0xB05CA3F5UL, 0x64268D99UL}, {0x9AE182C8UL, 0xBC9474E8UL},
+    {0xA4FC4BD4UL, 0xFC5558CAUL}, {0xE755178DUL, 0x58FC4E76UL},
+    {0x69B97DB1UL, 0xA4C03DFEUL}, {0xF9B5B7C4UL, 0xACC67C96UL},
+    {0xFC6A82D6UL, 0x4B8655FBUL}, {0x9C684CB6UL, 0xC4D24417UL},
+    {0x8EC97D29UL, 0x17456ED0UL}, {0x6703DF9DUL, 0x2924E97EUL},
+    {0xC547F57EUL, 0x42A7444EUL}, {0x78E37644UL, 0xE7CAD29EUL},
+    {0xFE9A44E9UL, 0x362F05FAUL}, {0x08BD35CCUL, 0x38336615UL},
+    {0x9315E5EBUL, 0x3A129ACEUL}, {0x94061B87UL, 0x1E04DF75UL},
+    {0xDF1D9F9DUL, 0x784BA010UL}, {0x3BBA57B6UL, 0x8871B59DUL},
+    {0xD2B7ADEEUL, 0xDED1F73FUL}, {0xF7A255D8UL, 0x3BC373F8UL},
+    {0xD7F4F244UL, 0x8C0CEB81UL}, {0xD95BE88CUL, 0xD210FFA7UL},
+    {0x336F52F8UL, 0xFF4728E7UL}, {0xA74049DAUL, 0xC312AC71UL},
+    {0xA2F61BB6UL, 0xE437FDB5UL}, {0x4F2A5CB0UL, 0x7F6A35B3UL},
+    {0x87D380BDUL, 0xA5BF7859UL}, {0x16B9F7E0UL, 0x6C453A21UL},
+    {0x7BA2484CUL, 0x8A0FD54EUL}, {0xF3A678CAUL, 0xD9A2E38CUL},
+    {0x39B0BF7DUL, 0xDE437BA2UL}, {0xFCAF55C1UL, 0xBF8A4424UL},
+    {0x18FCF680UL, 0x573FA594UL}, {0x4C0563B8UL, 0x9F495AC3UL},
+    {0x40E08793UL, 0x1A00930DUL}, {0x8CFFA941UL, 0x2EB642C1UL},
+    {0x68CA3905UL, 0x3261169FUL}, {0x7A1EE967UL, 0xD27579E2UL},
+    {0x9D1D60E5UL, 0x076F5B6FUL}, {0x3810E399UL, 0xB6F65BA2UL},
+    {0x32095B6DUL, 0x4AB5F9B1UL}, {0x35CAB621UL, 0x09DD038AUL},
+    {0xA90B2449UL, 0x9FCFAFB1UL}, {0x77A225A0UL, 0x7CC2C6BDUL},
+    {0x513E5E63UL, 0x4C70E331UL}, {0x4361C0CAUL, 0x3F692F12UL},
+    {0xD941ACA4UL, 0x4B20A45BUL}, {0x528F7C86UL, 0x02C5807BUL},
+    {0x52AB92BEUL, 0xB9613989UL}, {0x9D1DFA2EUL, 0xFC557F73UL},
+    {0x722FF175UL, 0xF572C348UL}, {0x1D1260A5UL, 0x1107FE97UL},
+    {0x7A249A57UL, 0xEC0C9BA2UL}, {0x04208FE9UL, 0xE8F7F2D6UL},
+    {0x5A110C60UL, 0x58B920A0UL}, {0x0CD9A497UL, 0x658A5698UL},
+    {0x56FD23C8UL, 0xF9715A4CUL}, {0x284C847BUL, 0x9D887AAEUL},
+    {0x04FEABFBUL, 0xBDB619CBUL}, {0x742E1E65UL, 0x1C60BA83UL},
+    {0x9A9632E6UL, 0x5904AD3CUL}, {0x881B82A1UL, 0x3B51B9E2UL},
+    {0x506E6744UL, 0xCD974924UL}, {0xB0183DB5UL, 0x6FFC6A79UL},
+    {0x0ED9B915UL, 0xC66ED37EUL}, {0x5E11E86DUL, 0x5873D484UL},
+    {0xF678647EUL, 0x3519AC6EUL}, {0x1B85D488UL, 0xD0F20CC5UL},
+    {0xDAB9FE65UL, 0x25D89021UL}, {0x0D151D86UL, 0xADB73615UL},
+    {0xA865A54EUL, 0xDCC0F019UL}, {0x93C42566UL, 0xAEF98FFBUL},
+    {0x99E7AFEAUL, 0xBE000731UL}, {0x48CBFF08UL, 0x6DDF285AUL},
+    {0x7F9B6AF1UL, 0xEBF78BAFUL}, {0x58627E1AUL, 0x149BBA21UL},
+    {0x2CD16E2AUL, 0xBD791E33UL}, {0xD363EFF5UL, 0xF0977996UL},
+    {0x0CE2A38CUL, 0x344A6EEDUL}, {0x1A804AADUL, 0xB9CFA741UL},
+    {0x907F3042UL, 0x1D78C5DEUL}, {0x501F65EDUL, 0xB3034D07UL},
+    {0x37624AE5UL, 0xA48FA6E9UL}, {0x957BAF61UL, 0x700CFF4EUL},
+    {0x3A6C2793UL, 0x4E31188AUL}, {0xD4950353UL, 0x6ABCA345UL},
+    {0x088E0495UL, 0x89C432E0UL}, {0xF943AEE7UL, 0xFEBF21B8UL},
+    {0x6C3B8E3EUL, 0x336139D3UL}, {0x364F6FFAUL, 0x464EE52EUL},
+    {0xD60F6DCEUL, 0xDC314222UL}, {0x56963B0DUL, 0xCA418FC0UL},
+    {0x16F50EDFUL, 0x91E513AFUL}, {0xEF195591UL, 0x4B609F93UL},
+    {0x565601C0UL, 0x364E3228UL}, {0xECB53939UL, 0x887E8175UL},
+    {0xBAC7A9A1UL, 0x8531294BUL}, {0xB344C470UL, 0x397BBA52UL},
+    {0x65D34954UL, 0xDAF3CEBDUL}, {0xB4B81B3FUL, 0xA97511E2UL},
+    {0xB4220611UL, 0x93D6F6A7UL}, {0x07158240UL, 0x1C38434DUL},
+    {0x7A13F18BUL, 0xBEDC4FF5UL}, {0xBC4097B1UL, 0x16C524D2UL},
+    {0x59B97885UL, 0xE2F2EA28UL}, {0x99170A5DUL, 0xC3115544UL},
+    {0x6F423357UL, 0xE7C6A9F9UL}, {0x325928EEUL, 0x6E6F8794UL},
+    {0xD0E43662UL, 0x28B03343UL}, {0x565C31F7UL, 0xDE89EA27UL},
+    {0x30F56114UL, 0x84119414UL}, {0xD873DB39UL, 0x1292ED4FUL},
+    {0x7BD94E1DUL, 0x8E17DEBCUL}, {0xC7D9F168UL, 0x64A76E94UL},
+    {0x947AE053UL, 0xEE56E63CUL}, {0xC8C93882UL, 0xF9475F5FUL},
+    {0x3A9BF55BUL, 0xA91F81CAUL}, {0xD9A11FBBUL, 0x3D9808E4UL},
+    {0x0FD22063UL, 0xEDC29FCAUL}, {0xB3F256D8UL, 0xACA0B0B9UL},
+    {0xB03031A8UL, 0xB4516E84UL}, {0x35DD37D5UL, 0x871448AFUL},
+    {0xE9F6082BUL, 0x05542E4EUL}, {0xEBFAFA33UL, 0xD7254B59UL},
+    {0x9255ABB5UL, 0x0D532280UL}, {0xB9AB4CE5UL, 0x7F2D34F3UL},
+    {0x693501D6UL, 0x28297551UL}, {0xC62C58F9UL, 0x7DD949BFUL},
+    {0xCD454F8FUL, 0x19C5126AUL}, {0xBBE83F4EUL, 0xCC2BDECBUL},
+    {0xDC842B7EUL, 0x2819E230UL}, {0xBA89142EUL, 0x007503B8UL},
+    {0xA3BC941DUL, 0x0A5061CBUL}, {0xE9F6760EUL, 0x32CD8021UL},
+    {0x09C7E552UL, 0xBC76492FUL}, {0x852F5493UL, 0x4DA55CC9UL},
+    {0x8107FCCFUL, 0x064FCF56UL}, {0x098954D5UL, 0x1FFF6580UL},
+    {0x23B70EDBUL, 0x1955C4BFUL}, {0xC330DE42UL, 0x6430F69DUL},
+    {0x4715ED43UL, 0xE8A45C0AUL}, {0xA8D7E4DAUL, 0xB780A08DUL},
+    {0x0572B974UL, 0xF03CE0BBUL}, {0xB57D2E98UL, 0x5E1419C7UL},
+    {0xE8D9ECBEUL, 0x2CF3D73FUL}, {0x2FE4B171UL, 0x70E59750UL},
+    {0x11317BA8UL, 0x7905E790UL}, {0x7FBF21ECUL, 0x8A1F45ECUL},
+    {0x1725CABFUL, 0xCB045B00UL}, {0x964E915CUL, 0xD5E2B207UL},
+    {0x3E2B8BCBUL, 0xF016D66DUL}, {0xBE7444E3UL, 0x9328A0ACUL},
+    {0xF85B2B4FUL, 0xBCDE44B7UL}, {0x49353FEAUL, 0x39BA63B1UL},
+    {0x1DD01AAFUL, 0xCD53486AUL}, {0x1FCA8A92UL, 0xFD719F85UL},
+    {0xFC7C95D8UL, 0x27357AFAUL}, {0x18A6A990UL, 0xC8B35EBDUL},
+    {0xCCCB7005UL, 0xC6B9C28DUL}, {0x3BDBB92CUL, 0x43B17F26UL},
+    {0xAA70B5B4UL, 0xF89695A2UL}, {0xE94C39A5UL, 0x4A98307FUL},
+    {0xB7A0B174UL, 0xCFF6F36EUL}, {0xD4DBA847UL, 0x29AF48ADUL},
+    {0x2E18BC1AUL, 0xD9704A68UL}, {0x2DE0966DUL, 0xAF2F8B1CUL},
+    {0xB9C11D5BUL, 0x1E43A07EUL}, {0x64972D68UL, 0xDEE33360UL},
+    {0x94628D38UL, 0xD0C20584UL}, {0xDBC0D2B6UL, 0xAB90A559UL},
+    {0xD2733C43UL, 0x35C6A72FUL}, {0x7E75D99DUL, 0x94A70F4DUL},
+    {0x6CED1983UL, 0x376FA72BUL}, {0x97FCAACBUL, 0xF030BC24UL},
+    {0x7B77497BUL, 0x32503B12UL}, {0x8547EDDFUL, 0xB81CCB94UL},
+    {0x79999CDFUL, 0xF70902CBUL}, {0xCFFE1939UL, 0x438E9B24UL},
+    {0x829626E3UL, 0x892D95D7UL}, {0x92FAE242UL, 0x91F2B3F1UL},
+    {0x63E22C14UL, 0x7B9C3403UL}, {0xC678B6D8UL, 0x60284A1CUL},
+    {0x58738888UL, 0x50659AE7UL}, {0x0981DCD2UL, 0x96A8736DUL},
+    {0x9F65789AUL, 0x6509A440UL}, {0x9FF38FEDUL, 0x72E9052FUL},
+    {0xE479EE5BUL, 0x9930578CUL}, {0xE7F28ECDUL, 0x2D49EECDUL},
+    {0x56C074A5UL, 0x81EA17FEUL}, {0x5544F7D7UL, 0x74B14AEFUL},
+    {0x7B3F0195UL, 0xFC6F290FUL}, {0x12153635UL, 0xB2C0CF57UL},
+    {0x7F5126DBUL, 0xBA5E0CA7UL}, {0x7A76956CUL, 0x3EAFB413UL},
+    {0x3D5774A1UL, 0x1D31AB39UL}, {0x8A1B0838UL, 0x21F40CB4UL},
+    {0x7B4A38E3UL, 0x2537DF62UL}, {0x95011364UL, 0x6D1D6E03UL},
+    {0x4DA8979AUL, 0x0041E8A9UL}, {0x3BC36E07UL, 0x8F7515D7UL},
+    {0x5D0A12F2UL, 0x7AD310D1UL}, {0x7F9D1A2EUL, 0x1EBE1327UL},
+    {0xDA3A361BUL, 0x1C5157B1UL}, {0xDCDD7D20UL, 0x903D0C25UL},
+    {0x36833336UL, 0xD068F707UL}, {0xCE68341FUL, 0x79893389UL},
+    {0xAB909016UL, 0x8DD05F34UL}, {0x43954B32UL, 0x52DC25E5UL},
+    {0xB438C2B6UL, 0x7F98E5E9UL}, {0x10DCD78EUL, 0x3851A492UL},
+    {0xDBC27AB5UL, 0x447822BFUL}, {0x9B3CDB65UL, 0xF82CA382UL},
+    {0xB67B7896UL, 0x167B4C84UL}, {0xBFCED1B0UL, 0x048EAC50UL},
+    {0xA9119B60UL, 0x369FFEBDUL}, {0x1FFF7AC8UL, 0x0904BF45UL},
+    {0xAC12FB17UL, 0x1817EEE7UL}, {0xAF08DA91UL, 0x77DDA93DUL},
+    {0x1B0CAB93UL, 0x6E65C744UL}, {0xB559EB1DUL, 0x04E5E932UL},
+    {0xC37B45B3UL, 0xF8D6F2BAUL}, {0xC3A9DC22UL, 0x8CAAC9E9UL},
+    {0xF3B8B667UL, 0x5A6507FFUL}, {0x9FC477DEUL, 0x4ED681DAUL},
+    {0x67378D8EUL, 0xCCEF96CBUL}, {0x6DD856D9UL, 0x4D259236UL},
+    {0xA319CE15UL, 0xB0B4DB31UL}, {0x07397375UL, 0x1F12DD5EUL},
+    {0x8A8E849EUL, 0xB32781A5UL}, {0xE1925C71UL, 0x285279F5UL},
+    {0x74C04BF1UL, 0x790C0EFEUL}, {0x4DDA4815UL, 0x3C94938AUL},
+    {0x9D266D6AUL, 0x1CC0542CUL}, {0x7440FB81UL, 0x6508C4FEUL},
+    {0x13328503UL, 0xDF48229FUL}, {0xD6BF7BAEUL, 0xE43CAC40UL},
+    {0x4838D65FUL, 0x6EF6748FUL}, {0x1E152328UL, 0xF3318DEAUL},
+    {0x8F8419A3UL, 0x48F296BFUL}, {0x72C8834AUL, 0x5957B511UL},
+    {0xD7A023A7UL, 0x3260B45CUL}, {0x94EBC8ABUL, 0xCFB56DAEUL},
+    {0x9FC10D0FUL, 0x989993E0UL}, {0xDE68A235UL, 0x5B93CAE6UL},
+    {0xA44CFE79UL, 0xAE538BBEUL}, {0x9D1D84FCUL, 0xCE371425UL},
+    {0x51D2B1ABUL, 0x2DDFB636UL}, {0x2FD7E4B9UL, 0xE72CD38CUL},
+    {0x65CA5B96UL, 0xB7552210UL}, {0xDD69A0D8UL, 0xAB3B546DUL},
+    {0x604D51B2UL, 0x5FBF70E2UL}, {0x73AA8A56UL, 0x4FB7AC9EUL},
+    {0x1A8C1E99UL, 0x2B941148UL}, {0xAAC40A27UL, 0x03D9BEA0UL},
+    {0x764DBEAEUL, 0x7FA4F3A6UL}, {0x1E99B96EUL, 0x70A9BE8BUL},
+    {0x2C5E9DEBUL, 0x57EF4743UL}, {0x3A938FEEUL, 0x32D29981UL},
+    {0x26E6DB8FUL, 0xFDF5ADFEUL}, {0x469356C5UL, 0x04EC9F9DUL},
+    {0xC8763C5BUL, 0x08D1908CUL}, {0x3F6C6AF8UL, 0x59D80055UL},
+    {0x7F7CC394UL, 0x20A3A545UL}, {0x9BFB227EUL, 0xBDF4C5CEUL},
+    {0x89039D79UL, 0xD6FC5C5CUL}, {0x8FE88B57UL, 0x305E2AB6UL},
+    {0xA09E8C8CUL, 0x35AB96DEUL}, {0xFA7E3939UL, 0x83325753UL},
+    {0xD6B6D0ECUL, 0xC617C699UL}, {0xDFEA21EAUL, 0x9E7557E3UL},
+    {0xB67C1FA4UL, 0x81680AF8UL}, {0xCA1E3785UL, 0xA9E724E5UL},
+    {0x1CFC8BEDUL, 0x0D681639UL}, {0xD18D8549UL, 0xD140CAEAUL},
+    {0x4ED0FE7EUL, 0x9DC91335UL}, {0xE4DBF063UL, 0x4473F5D2UL},
+    {0x1761F93AUL, 0x44D5AEFEUL}, {0x53898E4CUL, 0x3910DA55UL},
+    {0x734DE818UL, 0x1F6EC39AUL}, {0x2680B122UL, 0xBAA28D97UL},
+    {0x298AF231UL, 0xC85BAFABUL}, {0x7983EED3UL, 0x740847D5UL},
+    {0x66C1A2A1UL, 0xA60CD889UL}, {0x9E17E496UL, 0x42A3E4C1UL},
+    {0xEDB454E7UL, 0xBADC0805UL}, {0x50B704CAUL, 0xB602C329UL},
+    {0x4CC317FBUL, 0x9CDDD023UL}, {0x66B4835DUL, 0x9EAFEA22UL},
+    {0x219B97E2UL, 0x6FFC81BDUL}, {0x261E4E4CUL, 0x0A333A9DUL},
+    {0x1FE2CCA7UL, 0x6517DB90UL}, {0xD7504DFAUL, 0x8816EDBBUL},
+    {0xB9571FA0UL, 0x4DC089C8UL}, {0x1DDC0325UL, 0x259B27DEUL},
+    {0xCF3F4688UL, 0x801EB9AAUL}, {0xF4F5D05CUL, 0x10CAB243UL},
+    {0x38B6525CUL, 0x21A42B0EUL}, {0x36F60E2BUL, 0xA4FA6800UL},
+    {0xEB359380UL, 0x3173E0CEUL}, {0x9C4CD625UL, 0x7C5A3603UL},
+    {0xAF0C317DUL, 0x32ADAA8AUL}, {0x258E5A80UL, 0xC7204C4BUL},
+    {0x8B889D62UL, 0x4D44885DUL}, {0xF4D14597UL, 0xE660F855UL},
+    {0xD4347F66UL, 0xEC8941C3UL}, {0xE699ED85UL, 0xB0DFB40DUL},
+    {0x2472F620UL, 0x7C2D0484UL}, {0xC2A1E7B5UL, 0xB459AEB5UL},
+    {0xAB4F6451UL, 0xCC1D45ECUL}, {0x63767572UL, 0xAE3D6174UL},
+    {0xA59E0BD1UL, 0x01731A28UL}, {0x116D0016UL, 0xCB948F09UL},
+    {0x2CF9C8CAUL, 0x052F6E9FUL}, {0x0B090A75UL, 0x60A968E3UL},
+    {0xABEEDDB2UL, 0xDDE06FF1UL}, {0x58EFC10BUL, 0x06A2068DUL},
+    {0xC6E57A78UL, 0xFBD986E0UL}, {0x2EAB8CA6UL, 0x3CE802D7UL},
+    {0x14A19564UL, 0x0116F336UL}, {0x7C0828DDUL, 0x624EC390UL},
+    {0xD74BBE77UL, 0xE6116AC7UL}, {0x804456AFUL, 0x10F5FB53UL},
+    {0xEBE9EA2AUL, 0xDF4321C7UL}, {0x03219A39UL, 0xEE587A30UL},
+    {0x49787FEFUL, 0x17AF9924UL}, {0xA1E9300CUL, 0xD8520548UL},
+    {0x5B45E522UL, 0xE4B1B4EFUL}, {0xB49C3B39UL, 0x95091A36UL},
+    {0xD4490AD5UL, 0x26F14431UL}, {0x12A8F216UL, 0xAF9418C2UL},
+    {0x001F837CUL, 0xC7350524UL}, {0x1877B51EUL, 0x57A764D5UL},
+    {0xA2853B80UL, 0xF17F58EEUL}, {0x993E1DE7UL, 0x2D36D310UL},
+    {0xB3598080UL, 0xCE64A656UL}, {0x252F59CFUL, 0x0D9F04BBUL},
+    {0xD23C8E17UL, 0x6D113600UL}, {0x1BDA0492UL, 0xE7E4586EUL},
+    {0x21E0BD50UL, 0x26C619BFUL}, {0x3B097ADAUL, 0xF088F94EUL},
+    {0x8D14DEDBUL, 0x30BE846EUL}, {0xF95CFFA2UL, 0x3AF5F6F4UL},
+    {0x38717007UL, 0x61B3F743UL}, {0xCA672B91UL, 0xE9E4FA16UL},
+    {0x64C8E531UL, 0xBFF53B55UL}, {0x241260EDUL, 0x4AD1E87DUL},
+    {0x106C09B9UL, 0x72D2E822UL}, {0x7FBA1954UL, 0x10E5CA30UL},
+    {0x7884D9BCUL, 0x6CB569D8UL}, {0x0647DFEDUL, 0xCD894A29UL},
+    {0x63573FF0UL, 0x3E224774UL}, {0x4FC8E956UL, 0x0F91B123UL},
+    {0x1DB956E4UL, 0x50275779UL}, {0xB8D91274UL, 0xB9E9D4FBUL},
+    {0xA2EBEE47UL, 0xE2FBFCE1UL}, {0xD9F1F30CUL, 0xCD97FB09UL},
+    {0xEFED53D7UL, 0x5FD64E6BUL}, {0x2E6D02C3UL, 0x6017F67FUL},
+    {0xA9AA4D20UL, 0xDB084E9BUL}, {0xB64BE8D8UL, 0xB25396C1UL},
+    {0x70CB6AF7UL, 0xC2D5BCF0UL}, {0x98F076A4UL, 0xF7A2322EUL},
+    {0xBF844708UL, 0x05E69B5FUL}, {0x94C3251FUL, 0x06F90CF3UL},
+    {0x3E003E61UL, 0x6A6591E9UL}, {0xB925A6CDUL, 0x0421AFF3UL},
+    {0x61BDD130UL, 0x7C66E300UL}, {0xBF8D5108UL, 0xE27E0D48UL},
+    {0x240AB57AUL, 0x8B888B20UL}, {0xFC87614BUL, 0xAF287E07UL},
+    {0xEF02CDD0UL, 0x6FFDB432UL}, {0xA1082C04UL, 0x66DF6C0AUL},
+    {0x8215E577UL, 0x001332C8UL}, {0xD39BB9C3UL, 0xA48DB6CFUL},
+    {0x27382596UL, 0x34305C14UL}, {0x61CF4F94UL, 0xC97DF93DUL},
+    {0x1B6BACA2UL, 0xAE4E125BUL}, {0x758F450CUL, 0x88572E0BUL},
+    {0x959F587DUL, 0x507A8359UL}, {0xB063E962UL, 0xE045F54DUL},
+    {0x60E8ED72UL, 0xC0DFF5D1UL}, {0x7B649785UL, 0x55326F9FUL},
+    {0xFD080D23UL, 0x6DA814BAUL}, {0x8C90FD9BUL, 0x083F4558UL},
+    {0x106F72FEUL, 0x81E2C590UL}, {0x7976033AUL, 0x39F7D952UL},
+    {0xA4EC0132UL, 0x764CA04BUL}, {0x733EA705UL, 0xFAE4FA77UL},
+    {0xB4D8F77BUL, 0xC3E56167UL}, {0x9E21F4F9UL, 0x03B33FD9UL},
+    {0x9D765E41UL, 0x9FB69F6DUL}, {0xD30C088BUL, 0xA61EA5EFUL},
+    {0x5D94337FUL, 0xBFAF7F5BUL}, {0x1A4E4822UL, 0xEB4D7A59UL},
+    {0x6FFE73E8UL, 0x1B637FB3UL}, {0xDDF957BCUL, 0x36D8B9CAUL},
+    {0x64D0E29EUL, 0xEA8838B3UL}, {0x08DD9BDFUL, 0xD96B9F63UL},
+    {0x087E79E5UL, 0xA57D1D13UL}, {0xE328E230UL, 0xE3E2B3FBUL},
+    {0x1C2559E3UL, 0x0F0946BEUL}, {0x720BF5F2UL, 0x6F4D2EAAUL},
+    {0xB0774D26UL, 0x1CC609DBUL}, {0x443F64ECUL, 0x5A371195UL},
+    {0x4112CF68UL, 0x649A260EUL}, {0xD813F2FAUL, 0xB7F5C5CAUL},
+    {0x660D3257UL, 0x380841EEUL}, {0x59AC2C78UL, 0x73F910A3UL},
+    {0xE8469638UL, 0x77671A17UL}, {0x93B633ABUL, 0xFA3469F8UL},
+    {0xC0C0F5A6UL, 0x0EF4CDCFUL}, {0xCAF21ECDUL, 0x4377B28CUL},
+    {0x57277707UL, 0x199B8175UL}, {0x506C11B9UL, 0xD90E8B1DUL},
+    {0xD83CC268UL, 0x7A19255FUL}, {0x4A29C646UL, 0x5A314CD1UL},
+    {0xED2DF212UL, 0x16235097UL}, {0xB5635C95UL, 0xFF7296E2UL},
+    {0x22AF003AUL, 0xB672E811UL}, {0x52E76259UL, 0x6BF68235UL},
+    {0x9AEBA33AUL, 0xC6ECC6B0UL}, {0x944F6DE0UL, 0x9134DFB6UL},
+    {0x6C47BEC8UL, 0x83A7DE39UL}, {0x6AD047C4UL, 0x30A12104UL},
+    {0xA5B1CFDBUL, 0xA0AB4067UL}, {0x7C45D833UL, 0xAFF07862UL},
+    {0x5092EF95UL, 0x0A16DA0BUL}, {0x9338E69CUL, 0x052B8E7BUL},
+    {0x455A4B4CUL, 0xFE30E3F5UL}, {0x6B02E631UL, 0x95AD0CF8UL},
+    {0x6B17B224UL, 0xBAD6BF27UL}, {0xD1E0CCD2UL, 0x5BB9C169UL},
+    {0xDE0C89A5UL, 0x56B9AE70UL}, {0x50065E53UL, 0x5A213CF6UL},
+    {0x9C1169FAUL, 0x2777B874UL}, {0x78EDEFD6UL, 0x94AF1EEDUL},
+    {0x6DC93D95UL, 0x26A50E68UL}, {0xEE97F453UL, 0xF06791EDUL},
+    {0x32AB0EDBUL, 0x696703D3UL}, {0x3A6853C7UL, 0xE70757A7UL},
+    {0x31865CEDUL, 0x6120F37DUL}, {0x67FEF95DUL, 0x92607890UL},
+    {0x1F2B1D1FUL, 0x15F6DC9CUL}, {0xB69E38A8UL, 0x965C6B65UL},
+    {0xAA9119FFUL, 0x184CCCF4UL}, {0xF43C7328UL, 0x73F24C13UL},
+    {0xFB4A3D79UL, 0x4A9A80D2UL}, {0x3550C232UL, 0x1FD6109CUL},
+    {0x371F77E7UL, 0x6BB8417EUL}, {0x6BFA9AAEUL, 0x5EC05779UL},
+    {0xCD04F3FFUL, 0x001A4778UL}, {0xE3273522UL, 0x064480CAUL},
+    {0x9F91508BUL, 0xFFCFC14AUL}, {0x049A7F41UL, 0x061A9E60UL},
+    {0xFCB6BE43UL, 0xA9F2FE9BUL}, {0x08DE8A1CUL, 0x7797DA9BUL},
+    {0x8F9887E6UL, 0x078735A1UL}, {0xB5B4071DUL, 0xBFC73A66UL},
+    {0x230E343DUL, 0xFBA08D33UL}, {0x43ED7F5AUL, 0x0FAE657DUL},
+    {0x3A88A0FBUL, 0xBCB05C63UL}, {0x21874B8BUL, 0x4D2DBC4FUL},
+    {0x1BDEA12EUL, 0x35F6A8C9UL}, {0x53C065C6UL, 0xC8E63528UL},
+    {0xE34A1D25UL, 0x0E7A8D6BUL}, {0xD6B04D3BUL, 0x7651DD7EUL},
+    {0x5E90277EUL, 0x7CB39E2DUL}, {0x2C046F22UL, 0x062DC67DUL},
+    {0xB10BB459UL, 0x132D0A26UL}, {0x3FA9DDFBUL, 0x67E2F199UL},
+    {0x0E09B88EUL, 0x1914F7AFUL}, {0x10E8B35AUL, 0xF3EEAB37UL},
+    {0x9EEDECA8UL, 0xE272B933UL}, {0xD4C718BCUL, 0x4AE8AE5FUL},
+    {0x81536D60UL, 0x1170FC20UL}, {0x91B534F8UL, 0x85818A06UL},
+    {0xEC8177F8UL, 0x3F900978UL}, {0x190E714FUL, 0xADA5156EUL},
+    {0xB592BF39UL, 0xB0364963UL}, {0x89C350C8UL, 0x93AE7DC1UL},
+    {0xAC042E70UL, 0xF8B383F2UL}, {0xB49B52E5UL, 0x87A1EE60UL},
+    {0xFB152FE3UL, 0xFF26DA89UL}, {0x3E666E6FUL, 0x69AE2C15UL},
+    {0x3B544EBEUL, 0x544C19F9UL}, {0xE805A1E2UL, 0x90CF2456UL},
+    {0x24B33C9DUL, 0x7ED25117UL}, {0xE7473342UL, 0x7B72F0C1UL},
+    {0x0A804D18UL, 0xB7097475UL}, {0x57E3306DUL, 0x881EDB4FUL},
+    {0x4AE7D6A3UL, 0x6EB5DBCBUL}, {0x2D8D5432UL, 0x157064C8UL},
+    {0xD1E649DEUL, 0x1E7F268BUL}, {0x8A328A1CUL, 0xEDFE552CUL},
+    {0x07A3AEC7UL, 0x9624C7DAUL}, {0x84547DDCUL, 0x3E203C94UL},
+    {0x990A98FDUL, 0x5071D263UL}, {0x1A4FF126UL, 0x16EEFC89UL},
+    {0xF6F7FD14UL, 0x31714200UL}, {0x30C05B1BUL, 0xA332F41CUL},
+    {0x8D2636B8UL, 0x1555A786UL}, {0x46C9FEB5UL, 0x5D120902UL},
+    {0xCCEC0A73UL, 0xB49C9921UL}, {0x4E9D2827UL, 0x355FC492UL},
+    {0x19EBB029UL, 0x435DCB0FUL}, {0x4659D2B7UL, 0x43848A2CUL},
+    {0x963EF2C9UL, 0x6B33BE31UL}, {0x74F85198UL, 0xB05A2E7DUL},
+    {0x5A0F544DUL, 0xD2B1FB18UL}, {0x03727073UL, 0xC2E134B1UL},
+    {0xC7F6AA2DUL, 0xE59AEA61UL}, {0x352787BAUL, 0xA0D7C22FUL},
+    {0x9853EAB6UL, 0x3B5E0B35UL}, {0xABBDCDD7UL, 0xED5C0860UL},
+    {0xCF05DAF5UL, 0xAC8D77B0UL}, {0x49CAD48CUL, 0xEBF4A71EUL},
+    {0x7A4C10ECUL, 0x2158C4A6UL}, {0xD9E92AA2UL, 0x46BF719EUL},
+    {0x13AE978DUL, 0x09FE5557UL}, {0x730499AFUL, 0x921549FFUL},
+    {0x4E4B705BUL, 0x92903BA4UL}, {0xFF577222UL, 0xC14F0A3AUL},
+    {0x55B6344CUL, 0xF97AAFAEUL}, {0xB862225BUL, 0x055B6960UL},
+    {0xCAC09AFBUL, 0xDDD2CDB4UL}, {0xDAF8E982UL, 0x9FE96B5FUL},
+    {0xB5FDFC5DUL, 0x3132C498UL}, {0x310CB380UL, 0xDB6F7503UL},
+    {0xE87FBB46UL, 0x217A360EUL}, {0x2102AE46UL, 0x6EBB1148UL},
+    {0xF8549E1AUL, 0x3AA5E00DUL}, {0x07A69AFDUL, 0xCC42261AUL},
+    {0xC4C118BFUL, 0xE78FEAAEUL}, {0xF9F4892EUL, 0xD96BD438UL},
+    {0x1AF3DBE2UL, 0x5D8F45DAUL}, {0xF5B4B0B0UL, 0xD2DEEEB4UL},
+    {0x962ACEEFUL, 0xA82E1C84UL}, {0x046E3ECAUL, 0xAF453CE9UL},
+    {0xF05D1296UL, 0x81949A4CUL}, {0x964781CEUL, 0x734B3C84UL},
+    {0x9C2ED440UL, 0x81CE5FBDUL}, {0x522E23F3UL, 0x925E319EUL},
+    {0x177E00F9UL, 0xFC32F791UL}, {0x2BC60A63UL, 0xA6F3B3F2UL},
+    {0x222BBFAEUL, 0x61725606UL}, {0x486289DDUL, 0xCC3D6780UL},
+    {0x7DC7785BUL, 0x8EFDFC80UL}, {0x8AF38731UL, 0xC02BA980UL},
+    {0x1FAB64EAUL, 0x29A2DDF7UL}, {0xE4D94293UL, 0x22CD065AUL},
+    {0x9DA058C6UL, 0x7844F20CUL}, {0x24C0E332UL, 0xB70019B0UL},
+    {0x233003B5UL, 0xA6CFE6ADUL}, {0xD586BD01UL, 0xC5C217F6UL},
+    {0x5E563788UL, 0x5F29BC2BUL}, {0x7EBA726DUL, 0x8C94094BUL},
+    {0x0A56A5F0UL, 0xBFE39272UL}, {0xD79476A8UL, 0x4EE20D06UL},
+    {0x9E4C1269UL, 0xBAA4BF37UL}, {0x17EFEE45UL, 0xB0DEE640UL},
+    {0x1D95B0A5UL, 0xFCF90BC6UL}, {0x93CBE0B6UL, 0x99C2585DUL},
+    {0x65FA4F22UL, 0x7A2B6D79UL}, {0xD5F9E858UL, 0x292504D5UL},
+    {0xC2B5A03FUL, 0x71471A6FUL}, {0x59300222UL, 0xB4561E00UL},
+    {0xCE2F8642UL, 0xCA0712DCUL}, {0x7CA9723FUL, 0xBB2E8988UL},
+    {0x27853383UL, 0x47F2BA08UL}, {0xC61BB3A1UL, 0x41E50E8CUL},
+    {0x150F361DUL, 0xAB9DEC26UL}, {0x9F6A419DUL, 0x382595F4UL},
+    {0x64A53DC9UL, 0x24FE7AC9UL}, {0x142DE49FUL, 0xFF7A7C3DUL},
+    {0x0C335248UL, 0x857FA9E7UL}, {0x0A9C32D5UL, 0xEAE45305UL},
+    {0xE6C42178UL, 0xC4BBB92EUL}, {0x71F1CE24UL, 0x90D20B07UL},
+    {0xF1BCC3D2UL, 0x75AFE51AUL}, {0xE728E8C8UL, 0x3C334074UL},
+    {0x96FBF83AUL, 0x12884624UL}, {0x81A1549FUL, 0xD6573DA5UL},
+    {0x5FA7867CUL, 0xAF35E149UL}, {0x56986E2EUL, 0xF3ED091BUL},
+    {0x917F1DD5UL, 0xF8886C61UL}, {0xD20D8C88UL, 0xC8FFE65FUL},
+    // Castling
+    {0x31D71DCEUL, 0x64B2C310UL}, {0xF165B587UL, 0xDF898190UL},
+    {0xA57E6339UL, 0xDD2CF3A0UL}, {0x1EF6E6DBUL, 0xB1961EC9UL},
+    // En passant file
+    {0x70CC73D9UL, 0x0BC26E24UL}, {0xE21A6B35UL, 0xDF0C3AD7UL},
+    {0x003A93D8UL, 0xB2806962UL}, {0x1C99DED3UL, 0x3CB890A1UL},
+    {0xCF3145DEUL, 0x0ADD4289UL}, {0xD0E4427AUL, 0x5514FB72UL},
+    {0x77C621CCUL, 0x9FB3A483UL}, {0x67A34DACUL, 0x4356550BUL},
+    // White to move
+    {0xF8D626AAUL, 0xAF278509UL}
+};
+
+#endif // _RANDOM64_H_
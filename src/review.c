@@ -0,0 +1,145 @@
+/*
+ *  review.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include "global.h"
+
+#ifndef RETROMATE_ARCHIVE
+
+#define REVIEW_AT(i)            review.ring[(i) & (REVIEW_RING_SIZE - 1)]
+
+review_t review;
+
+/*-----------------------------------------------------------------------*/
+// Put letter on square (a8 = 0).  True if the board changed
+static bool review_show(uint8_t square, char letter) {
+    char *cb = global.state.chess_board;
+
+    if (cb[square] == letter) {
+        return false;
+    }
+    zobrist_square(square, cb[square], letter);
+    cb[square] = letter;
+    return true;
+}
+
+/*-----------------------------------------------------------------------*/
+// The record after review.shown, onto the board.  Returns the squares changed
+static uint8_t review_forward(bool draw) {
+    uint16_t i = review.shown;
+    uint8_t n = REVIEW_AT(i++);
+    uint8_t changed = 0;
+
+    while (n--) {
+        if (review_show(REVIEW_AT(i), REVIEW_AT(i + 2))) {
+            if (draw) {
+                plat_draw_square(REVIEW_AT(i));
+            }
+            changed++;
+        }
+        i += 3;
+    }
+    review.shown = (i + 1) & (REVIEW_RING_SIZE - 1);
+    return changed;
+}
+
+/*-----------------------------------------------------------------------*/
+// Back to the newest position, before a <12> changes the board again
+void review_begin(void) {
+    uint8_t changed = 0;
+
+    while (review.shown != review.head) {
+        changed |= review_forward(false);
+    }
+    if (changed) {
+        global.view.refresh = true;
+    }
+    review.count = 0;
+}
+
+/*-----------------------------------------------------------------------*/
+// A new game
+void review_clear(void) {
+    review.tail = review.head = review.shown = review.used = 0;
+    review.count = 0;
+}
+
+/*-----------------------------------------------------------------------*/
+// Keep the squares the <12> just parsed changed, dropping the oldest records
+// to make room
+void review_commit(void) {
+    uint16_t size = 2 + review.count * 3;
+    uint8_t i;
+
+    if (!review.count) {
+        return;
+    }
+    if (review.count > REVIEW_SQUARES_MAX) {
+        // Not a move, so there's no going back past it
+        review_clear();
+        return;
+    }
+    // Never quite full, so head == tail only when empty
+    while (review.used + size >= REVIEW_RING_SIZE) {
+        i = REVIEW_AT(review.tail);
+        review.tail = (review.tail + 2 + i * 3) & (REVIEW_RING_SIZE - 1);
+        review.used -= 2 + i * 3;
+    }
+    REVIEW_AT(review.head) = review.count;
+    for (i = 0; i < review.count * 3; i++) {
+        REVIEW_AT(review.head + 1 + i) = review.squares[i];
+    }
+    REVIEW_AT(review.head + size - 1) = review.count;
+    review.head = review.shown = (review.head + size) & (REVIEW_RING_SIZE - 1);
+    review.used += size;
+}
+
+/*-----------------------------------------------------------------------*/
+// Called for each square a <12> changes, before the board is updated
+void review_square(uint8_t square, char before, char after) {
+    uint8_t *s;
+
+    if (review.count < REVIEW_SQUARES_MAX) {
+        s = &review.squares[review.count * 3];
+        s[0] = square;
+        s[1] = before;
+        s[2] = after;
+        review.count++;
+    } else {
+        review.count = REVIEW_SQUARES_MAX + 1;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// A move on, or back, from what the board shows.  Only the squares the move
+// changed are drawn
+void review_step(bool forward) {
+    uint16_t i;
+    uint8_t n;
+
+    if (forward) {
+        if (review.shown != review.head) {
+            review_forward(true);
+        }
+        return;
+    }
+    if (review.shown == review.tail) {
+        return;
+    }
+    n = REVIEW_AT(review.shown - 1);
+    i = review.shown - 1 - n * 3;
+    review.shown = (i - 1) & (REVIEW_RING_SIZE - 1);
+    while (n--) {
+        if (review_show(REVIEW_AT(i), REVIEW_AT(i + 1))) {
+            plat_draw_square(REVIEW_AT(i));
+        }
+        i += 3;
+    }
+}
+
+#endif // RETROMATE_ARCHIVE
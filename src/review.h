@@ -0,0 +1,44 @@
+/*
+ *  review.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#ifndef _REVIEW_H_
+#define _REVIEW_H_
+
+// With the archive, review steps through its moves.  Without it (the 8-bit
+// machines) there's no move generator, so the squares each <12> changed are
+// kept instead, and stepping puts the letters back
+#ifndef RETROMATE_ARCHIVE
+
+// A record is the count, that many square, before, after triples, and the
+// count again, so it can be read from either end.  A normal move is 8 bytes
+#define REVIEW_RING_SIZE        512         // Must be a power of 2
+#define REVIEW_SQUARES_MAX      8           // More is a new position, not a move
+
+typedef struct _review {
+    uint8_t ring[REVIEW_RING_SIZE];
+    uint16_t tail;                  // Oldest record
+    uint16_t head;                  // Where the next record goes
+    uint16_t used;                  // Bytes from tail to head
+    uint16_t shown;                 // Record boundary the board shows
+    // The squares the <12> being parsed changed
+    uint8_t count;                  // REVIEW_SQUARES_MAX + 1 once too many
+    uint8_t squares[REVIEW_SQUARES_MAX * 3];
+} review_t;
+
+extern review_t review;
+
+void review_begin(void);
+void review_clear(void);
+void review_commit(void);
+void review_square(uint8_t square, char before, char after);
+void review_step(bool forward);
+
+#endif // RETROMATE_ARCHIVE
+
+#endif // _REVIEW_H_
@@ -21,9 +21,12 @@
 #define SQUARE_TEXT_WIDTH       8
 #define SQUARE_TEXT_HEIGHT      3
 
-// These are graphical coordinates
-#define CHARACTER_WIDTH         14
-#define CHARACTER_HEIGHT        32
+// These are graphical coordinates.  The character size comes from the font,
+// which is sized to fit the window, so everything below follows the window
+#define DEFAULT_FONT_SIZE       32
+#define MIN_FONT_SIZE           8
+#define CHARACTER_WIDTH         (sdl.character_width)
+#define CHARACTER_HEIGHT        (sdl.character_height)
 #define SCREEN_DISPLAY_WIDTH    (SCREEN_TEXT_WIDTH * CHARACTER_WIDTH)
 #define SCREEN_DISPLAY_HEIGHT   (SCREEN_TEXT_HEIGHT * CHARACTER_HEIGHT)
 #define SQUARE_DISPLAY_WIDTH    (SQUARE_TEXT_WIDTH * CHARACTER_WIDTH)
@@ -32,6 +35,21 @@
 #define BOARD_DISPLAY_HEIGHT    (SQUARE_DISPLAY_HEIGHT * 8)
 #define BOARD_START_X           CHARACTER_WIDTH
 #define BOARD_START_Y           0
+// The board texture holds the squares and the labels left of and below them
+#define BOARD_TEXTURE_WIDTH     (BOARD_START_X + BOARD_DISPLAY_WIDTH)
+#define BOARD_TEXTURE_HEIGHT    (BOARD_DISPLAY_HEIGHT + CHARACTER_HEIGHT)
+// The piece atlas is scaled to fit a square once, when the layout changes
+#define PIECE_SIZE              (sdl.piece_size)
+
+// The settings, in the working directory
+#define CONFIG_FILE_NAME        "retromate.cfg"
+
+// Received text stays in the ring, where the terminal spans point, until the
+// ring wraps.  That way the terminal only copies it when it's shown
+#define RECV_RING_SIZE          (16 * 1024)
+#define RECV_CHUNK_SIZE         1024
+// A line and its \n, sent in one go
+#define SEND_BUFFER_SIZE        256
 
 // Using C64 colors in SDL as well
 enum {
@@ -57,13 +75,41 @@ typedef struct SDL_Renderer SDL_Renderer;
 typedef struct SDL_Window SDL_Window;
 typedef struct TTF_Font TTF_Font;
 typedef struct SDL_Texture SDL_Texture;
+typedef struct SDL_Surface SDL_Surface;
+typedef struct SDL_Thread SDL_Thread;
+typedef struct SDL_mutex SDL_mutex;
+typedef struct SDL_cond SDL_cond;
+
+#ifdef RETROMATE_ARCHIVE
+// An append waiting for the writer thread
+typedef struct _archive_write {
+    struct _archive_write *next;
+    const char *path;
+    uint32_t size;
+    uint8_t data[];
+} archive_write_t;
+#endif
 
 typedef struct _sdl {
     SDL_Renderer *renderer;
     SDL_Window *window;
     TTF_Font *font;
+    int character_width;
+    int character_height;
+    int output_w;               // Drawable size, in pixels
+    int output_h;
+    int origin_x;               // Where the framebuffer goes in the window
+    int origin_y;
+    float mouse_scale_x;        // Window coordinates to pixels
+    float mouse_scale_y;
     SDL_Texture *framebuffer;
+    SDL_Surface *piece_surface; // The unscaled piece atlas
     SDL_Texture *piece_texture;
+    int piece_size;
+    SDL_Texture *board_texture;
+    int piece_texture_w;
+    int piece_texture_h;
+    uint8_t highlight[64];      // 0 or HCOLOR_* + 1, drawn over the framebuffer
     uint32_t draw_color;
     uint32_t text_bg_color;
     char **help_text[2];
@@ -74,10 +120,45 @@ typedef struct _sdl {
 #else
     int sockfd;
 #endif
-    unsigned char recv_buf[1025];
+    unsigned char recv_buf[RECV_RING_SIZE + 1];
+    int recv_head;
+    char send_buffer[SEND_BUFFER_SIZE];
+    tLogSpan terminal_spans[SCREEN_TEXT_HEIGHT];
     void (*receive_callback)(const unsigned char *data, int len);
+    char *history;              // LOG_HISTORY_MAX terminal rows
+#ifdef RETROMATE_PERF
+    bool perf_overlay;          // F3 shows the frame timings on top
+#endif
+#ifdef RETROMATE_ENGINE
+    // engine_mutex guards all of these.  A start or stop makes a new serial,
+    // and the search of any other serial is stale, so stops and isn't shown
+    SDL_Thread *engine_thread;
+    SDL_mutex *engine_mutex;
+    SDL_cond *engine_cond;      // A position is pending, or quit
+    position_t engine_position; // The next to search
+    bool engine_pending;
+    bool engine_quit;
+    uint32_t engine_serial;
+    uint32_t engine_searching;  // The serial of the search in progress
+    uint32_t engine_deadline;   // SDL_GetTicks when the search must stop
+    engine_result_t engine_result;
+    bool engine_result_new;
+#endif
+#ifdef RETROMATE_ARCHIVE
+    // archive_mutex guards these.  The writer takes the whole queue at once
+    SDL_Thread *archive_thread;
+    SDL_mutex *archive_mutex;
+    SDL_cond *archive_cond;     // Queued, written, or quit
+    archive_write_t *archive_head;
+    archive_write_t *archive_tail;
+    bool archive_busy;          // Writing what it took
+    bool archive_quit;
+#endif
 } sdl_t;
 
 extern sdl_t sdl;
 
+void plat_draw_benchmark(int frames);
+void plat_draw_cache_board(void);
+
 #endif // _PLATSDL2_H_
@@ -10,6 +10,18 @@
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL.h>
+#include <fcntl.h>
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#if defined(RETROMATE_BOOK) || defined(RETROMATE_ARCHIVE)
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/mman.h>
+#endif
+#endif
 
 #include "../global.h"
 
@@ -25,12 +37,267 @@ static void plat_load_assets_from_memory(void) {
         exit(1);
     }
 
-    sdl.piece_texture = SDL_CreateTextureFromSurface(sdl.renderer, surface);
+    // Kept, so the atlas can be scaled from the original when the window resizes
+    sdl.piece_surface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
     SDL_FreeSurface(surface);
 
+    if (!sdl.piece_surface) {
+        exit(1);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Average 2x2 blocks, weighted by alpha so the transparent pixels around a
+// piece don't darken its edges
+static SDL_Surface *plat_core_halve_surface(SDL_Surface *source) {
+    SDL_Surface *half = SDL_CreateRGBSurfaceWithFormat(0, source->w / 2, source->h / 2, 32, SDL_PIXELFORMAT_ARGB8888);
+    int x, y, i;
+
+    if (!half) {
+        exit(1);
+    }
+    for (y = 0; y < half->h; y++) {
+        const Uint32 *row0 = (const Uint32 *)((const Uint8 *)source->pixels + y * 2 * source->pitch);
+        const Uint32 *row1 = (const Uint32 *)((const Uint8 *)row0 + source->pitch);
+        Uint32 *dest = (Uint32 *)((Uint8 *)half->pixels + y * half->pitch);
+        for (x = 0; x < half->w; x++) {
+            Uint32 pixels[4] = {row0[x * 2], row0[x * 2 + 1], row1[x * 2], row1[x * 2 + 1]};
+            Uint32 a = 0, r = 0, g = 0, b = 0;
+            for (i = 0; i < 4; i++) {
+                Uint32 alpha = pixels[i] >> 24;
+                a += alpha;
+                r += ((pixels[i] >> 16) & 0xff) * alpha;
+                g += ((pixels[i] >> 8) & 0xff) * alpha;
+                b += (pixels[i] & 0xff) * alpha;
+            }
+            dest[x] = a ? (a / 4) << 24 | (r / a) << 16 | (g / a) << 8 | (b / a) : 0;
+        }
+    }
+    return half;
+}
+
+/*-----------------------------------------------------------------------*/
+// Scale the piece atlas to PIECE_SIZE tiles, so drawing a piece is a 1:1 copy.
+// Halve while it's more than twice too big, then stretch the rest of the way
+static void plat_core_scale_pieces(void) {
+    SDL_Surface *source = sdl.piece_surface;
+    SDL_Surface *scaled, *half;
+
+    while (source->w >= 2 * 6 * PIECE_SIZE) {
+        half = plat_core_halve_surface(source);
+        if (source != sdl.piece_surface) {
+            SDL_FreeSurface(source);
+        }
+        source = half;
+    }
+    scaled = SDL_CreateRGBSurfaceWithFormat(0, 6 * PIECE_SIZE, 2 * PIECE_SIZE, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!scaled || SDL_SoftStretchLinear(source, NULL, scaled, NULL) < 0) {
+        exit(1);
+    }
+    if (source != sdl.piece_surface) {
+        SDL_FreeSurface(source);
+    }
+
+    if (sdl.piece_texture) {
+        SDL_DestroyTexture(sdl.piece_texture);
+    }
+    sdl.piece_texture = SDL_CreateTextureFromSurface(sdl.renderer, scaled);
+    SDL_FreeSurface(scaled);
+
     if (!sdl.piece_texture) {
         exit(1);
     }
+    SDL_QueryTexture(sdl.piece_texture, NULL, NULL, &sdl.piece_texture_w, &sdl.piece_texture_h);
+}
+
+/*-----------------------------------------------------------------------*/
+static void plat_core_open_font(int point_size) {
+    SDL_RWops *rw = SDL_RWFromConstMem(ProggyClean_ttf, ProggyClean_ttf_len);
+    if (sdl.font) {
+        TTF_CloseFont(sdl.font);
+    }
+    sdl.font = TTF_OpenFontRW(rw, 1, point_size);
+    if (!sdl.font) {
+        exit(1);
+    }
+    // The font is monospaced
+    TTF_SizeText(sdl.font, "W", &sdl.character_width, NULL);
+    sdl.character_height = TTF_FontHeight(sdl.font);
+}
+
+/*-----------------------------------------------------------------------*/
+// Fit the text screen to the drawable size, in real pixels, and make all the
+// size dependent textures.  Returns false if the size didn't change
+static bool plat_core_layout(void) {
+    int output_w, output_h, window_w, window_h, point_size;
+
+    SDL_GetRendererOutputSize(sdl.renderer, &output_w, &output_h);
+    if (sdl.framebuffer && output_w == sdl.output_w && output_h == sdl.output_h) {
+        return false;
+    }
+    sdl.output_w = output_w;
+    sdl.output_h = output_h;
+
+    // On HiDPI displays, mouse events are in window units, not pixels
+    SDL_GetWindowSize(sdl.window, &window_w, &window_h);
+    sdl.mouse_scale_x = (float)output_w / window_w;
+    sdl.mouse_scale_y = (float)output_h / window_h;
+
+    // The biggest font that fits.  The height usually decides it
+    point_size = output_h / SCREEN_TEXT_HEIGHT + 1;
+    do {
+        plat_core_open_font(point_size);
+    } while ((SCREEN_DISPLAY_WIDTH > output_w || SCREEN_DISPLAY_HEIGHT > output_h) && --point_size >= MIN_FONT_SIZE);
+
+    sdl.piece_size = MIN(SQUARE_DISPLAY_WIDTH, SQUARE_DISPLAY_HEIGHT);
+    sdl.origin_x = (output_w - SCREEN_DISPLAY_WIDTH) / 2;
+    sdl.origin_y = (output_h - SCREEN_DISPLAY_HEIGHT) / 2;
+
+    // Use a texture as the "background" - this works with the 8-bit design of
+    // drawing as little as possible - the texture captures the cumulative drawing
+    // over frames
+    if (sdl.framebuffer) {
+        SDL_DestroyTexture(sdl.framebuffer);
+    }
+    sdl.framebuffer = SDL_CreateTexture(
+                          sdl.renderer,
+                          SDL_PIXELFORMAT_RGBA8888,
+                          SDL_TEXTUREACCESS_TARGET,
+                          SCREEN_DISPLAY_WIDTH,
+                          SCREEN_DISPLAY_HEIGHT
+                      );
+    if (!sdl.framebuffer) {
+        printf("error: framebuffer texture is null\n");
+        exit(1);
+    }
+    // Set the texture as the target for drawing commands
+    SDL_SetRenderTarget(sdl.renderer, sdl.framebuffer);
+
+    plat_core_scale_pieces();
+    plat_draw_cache_board();
+    return true;
+}
+
+#ifdef RETROMATE_ARCHIVE
+/*-----------------------------------------------------------------------*/
+static void plat_core_archive_sync(FILE *fp) {
+    fflush(fp);
+#ifdef _WIN32
+    _commit(_fileno(fp));
+#else
+    fsync(fileno(fp));
+#endif
+    fclose(fp);
+}
+
+/*-----------------------------------------------------------------------*/
+// Write the appends, in order, and free them.  Each file is synced before
+// the next is opened, so an index record is never on disk ahead of its game
+static void plat_core_archive_write(archive_write_t *w) {
+    archive_write_t *next;
+    FILE *fp = NULL;
+    const char *path = NULL;
+
+    while (w) {
+        if (!fp || strcmp(path, w->path)) {
+            if (fp) {
+                plat_core_archive_sync(fp);
+            }
+            path = w->path;
+            fp = fopen(path, "ab");
+        }
+        if (fp) {
+            fwrite(w->data, 1, w->size, fp);
+        }
+        next = w->next;
+        free(w);
+        w = next;
+    }
+    if (fp) {
+        plat_core_archive_sync(fp);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Waits for appends, and writes them off the main thread, so a sync never
+// stalls a frame
+static int plat_core_archive_thread(void *data) {
+    archive_write_t *w;
+
+    UNUSED(data);
+    SDL_LockMutex(sdl.archive_mutex);
+    while (sdl.archive_head || !sdl.archive_quit) {
+        if (!sdl.archive_head) {
+            SDL_CondWait(sdl.archive_cond, sdl.archive_mutex);
+            continue;
+        }
+        w = sdl.archive_head;
+        sdl.archive_head = sdl.archive_tail = NULL;
+        sdl.archive_busy = true;
+        SDL_UnlockMutex(sdl.archive_mutex);
+
+        plat_core_archive_write(w);
+
+        SDL_LockMutex(sdl.archive_mutex);
+        sdl.archive_busy = false;
+        SDL_CondBroadcast(sdl.archive_cond);
+    }
+    SDL_UnlockMutex(sdl.archive_mutex);
+    return 0;
+}
+#endif
+
+#ifdef RETROMATE_ENGINE
+/*-----------------------------------------------------------------------*/
+// Waits for a position, and searches it till the time budget runs out or
+// another start or stop comes
+static int plat_core_engine_thread(void *data) {
+    position_t position;
+
+    UNUSED(data);
+    SDL_LockMutex(sdl.engine_mutex);
+    while (!sdl.engine_quit) {
+        if (!sdl.engine_pending) {
+            SDL_CondWait(sdl.engine_cond, sdl.engine_mutex);
+            continue;
+        }
+        position = sdl.engine_position;
+        sdl.engine_pending = false;
+        sdl.engine_searching = sdl.engine_serial;
+        sdl.engine_deadline = SDL_GetTicks() + ENGINE_TIME_BUDGET_MS;
+        SDL_UnlockMutex(sdl.engine_mutex);
+
+        engine_search(&position);
+
+        SDL_LockMutex(sdl.engine_mutex);
+    }
+    SDL_UnlockMutex(sdl.engine_mutex);
+    return 0;
+}
+#endif
+
+#ifdef RETROMATE_PERF
+/*-----------------------------------------------------------------------*/
+// Start the input span when SDL queued the event, so the time it waited
+// for the last frame to finish counts too
+static void plat_core_perf_input(Uint32 timestamp) {
+    PERF_SPAN_BEGIN(PERF_SPAN_INPUT);
+    perf.span_start[PERF_SPAN_INPUT] -= (uint64_t)(SDL_GetTicks() - timestamp) * perf.frequency / 1000;
+}
+#endif
+
+/*-----------------------------------------------------------------------*/
+// The new framebuffer is empty, so everything has to be drawn again
+static void plat_core_resize(void) {
+    if (!plat_core_layout()) {
+        return;
+    }
+    plat_core_active_term(global.view.terminal_active);
+    global.view.terminal.modified = true;
+    global.view.info_panel.modified = true;
+    if (global.view.mc.m && !(global.view.mc.df & MENU_DRAW_HIDDEN)) {
+        global.view.mc.df = MENU_DRAW;
+    }
 }
 
 /*-----------------------------------------------------------------------*/
@@ -46,6 +313,44 @@ void plat_core_active_term(bool active) {
     }
 }
 
+/*-----------------------------------------------------------------------*/
+bool plat_core_config_load(void *data, uint8_t size) {
+    FILE *fp = fopen(CONFIG_FILE_NAME, "rb");
+    bool loaded;
+
+    if (!fp) {
+        return false;
+    }
+    loaded = fread(data, 1, size, fp) == size;
+    fclose(fp);
+    return loaded;
+}
+
+/*-----------------------------------------------------------------------*/
+// The file can hold the password, so only the user may read it
+void plat_core_config_save(const void *data, uint8_t size) {
+    FILE *fp;
+#ifdef _WIN32
+    fp = fopen(CONFIG_FILE_NAME, "wb");
+#else
+    int fd = open(CONFIG_FILE_NAME, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+
+    fp = NULL;
+    if (fd >= 0) {
+        // An older file keeps its mode, whatever open is given
+        fchmod(fd, 0600);
+        if (!(fp = fdopen(fd, "wb"))) {
+            close(fd);
+        }
+    }
+#endif
+
+    if (fp) {
+        fwrite(data, 1, size, fp);
+        fclose(fp);
+    }
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_core_copy_ascii_to_display(void *dest, const void *src, size_t n) {
     memcpy(dest, src, n);
@@ -72,49 +377,71 @@ uint8_t plat_core_get_status_x(void) {
     return 2 + SQUARE_TEXT_WIDTH * 8;
 }
 
+/*-----------------------------------------------------------------------*/
+const char *plat_core_history_get(uint16_t slot) {
+    return sdl.history + slot * LOG_HISTORY_COLS;
+}
+
+/*-----------------------------------------------------------------------*/
+// There's no shortage of memory, so the history is as long as it can be
+uint16_t plat_core_history_init(void) {
+    sdl.history = malloc(LOG_HISTORY_MAX * LOG_HISTORY_COLS);
+    return sdl.history ? LOG_HISTORY_MAX : 0;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_history_put(uint16_t slot, const char *row) {
+    memcpy(sdl.history + slot * LOG_HISTORY_COLS, row, LOG_HISTORY_COLS);
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_core_init(void) {
     uint8_t i, j;
+    // RETROMATE_BENCH_FRAMES=n times n board redraws, then exits
+    const char *bench_frames = getenv("RETROMATE_BENCH_FRAMES");
+#ifdef SDL_HINT_WINDOWS_DPI_AWARENESS
+    // Without this, Windows scales the window up and it goes blurry
+    SDL_SetHint(SDL_HINT_WINDOWS_DPI_AWARENESS, "permonitorv2");
+#endif
     SDL_Init(SDL_INIT_VIDEO);
     TTF_Init();
 
-    SDL_RWops *rw = SDL_RWFromConstMem(ProggyClean_ttf, ProggyClean_ttf_len);
-    sdl.font = TTF_OpenFontRW(rw, 1, CHARACTER_HEIGHT);
-    if (!sdl.font) {
-        exit(1);
-    }
-
-    // int w;
-    // TTF_SizeText(sdl.font, "W", &w, NULL);
-    // assert(CHARACTER_WIDTH == w);
-
+    // The window starts out the size of the text screen at the default font
+    plat_core_open_font(DEFAULT_FONT_SIZE);
     sdl.window = SDL_CreateWindow("RetroMate",
                                   SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
                                   SCREEN_DISPLAY_WIDTH, SCREEN_DISPLAY_HEIGHT,
-                                  SDL_WINDOW_SHOWN | SDL_WINDOW_ALLOW_HIGHDPI);
+                                  SDL_WINDOW_SHOWN | SDL_WINDOW_ALLOW_HIGHDPI | SDL_WINDOW_RESIZABLE);
+    SDL_SetWindowMinimumSize(sdl.window, SCREEN_DISPLAY_WIDTH * MIN_FONT_SIZE / DEFAULT_FONT_SIZE,
+                             SCREEN_DISPLAY_HEIGHT * MIN_FONT_SIZE / DEFAULT_FONT_SIZE);
 
-    sdl.renderer = SDL_CreateRenderer(sdl.window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    sdl.renderer = SDL_CreateRenderer(sdl.window, -1, bench_frames ? 0 : SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
 
-    // Use a texture as the "background" - this works with the 8-bit design of
-    // drawing as little as possible - the texture captures the cumulative drawing
-    // over frames
-    sdl.framebuffer = SDL_CreateTexture(
-                          sdl.renderer,
-                          SDL_PIXELFORMAT_RGBA8888,
-                          SDL_TEXTUREACCESS_TARGET,
-                          SCREEN_DISPLAY_WIDTH,
-                          SCREEN_DISPLAY_HEIGHT
-                      );
-    if (!sdl.framebuffer) {
-        printf("error: framebuffer texture is null\n");
-        exit(1);
+    plat_load_assets_from_memory();
+    plat_core_layout();
+
+    if (bench_frames) {
+        plat_draw_benchmark(atoi(bench_frames));
+        plat_core_shutdown();
+        exit(0);
     }
-    // Set the texture as the target for drawing commands
-    SDL_SetRenderTarget(sdl.renderer, sdl.framebuffer);
 
-    plat_load_assets_from_memory();
     SDL_StartTextInput();
 
+#ifdef RETROMATE_ENGINE
+    sdl.engine_mutex = SDL_CreateMutex();
+    sdl.engine_cond = SDL_CreateCond();
+    sdl.engine_thread = SDL_CreateThread(plat_core_engine_thread, "engine", NULL);
+#endif
+#ifdef RETROMATE_ARCHIVE
+    sdl.archive_mutex = SDL_CreateMutex();
+    sdl.archive_cond = SDL_CreateCond();
+    sdl.archive_thread = SDL_CreateThread(plat_core_archive_thread, "archive", NULL);
+#endif
+
+    // The receive ring outlives the callback, so the terminal can defer copying
+    global.view.terminal.spans = sdl.terminal_spans;
+
     // Set the cursor
     global.view.cursor_char[0] = -128;
     global.view.cursor_char[2] = -128;
@@ -146,10 +473,16 @@ uint8_t plat_core_key_input(input_event_t *evt) {
                 return 1;
                 break;
 
+            case SDL_WINDOWEVENT:
+                if (e.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+                    plat_core_resize();
+                }
+                break;
+
             case SDL_MOUSEMOTION:
                 evt->code = INPUT_MOUSE_MOVE;
-                evt->mouse_x = e.motion.x;
-                evt->mouse_y = e.motion.y;
+                evt->mouse_x = e.motion.x * sdl.mouse_scale_x - sdl.origin_x;
+                evt->mouse_y = e.motion.y * sdl.mouse_scale_y - sdl.origin_y;
                 evt->key_value = 0;
                 // don't return, keep looping "eating" updates
                 break;
@@ -157,9 +490,12 @@ uint8_t plat_core_key_input(input_event_t *evt) {
             case SDL_MOUSEBUTTONUP:
                 switch (e.button.button) {
                     case SDL_BUTTON_LEFT:
+#ifdef RETROMATE_PERF
+                        plat_core_perf_input(e.button.timestamp);
+#endif
                         evt->code = INPUT_MOUSE_CLICK;
-                        evt->mouse_x = e.button.x;
-                        evt->mouse_y = e.button.y;
+                        evt->mouse_x = e.button.x * sdl.mouse_scale_x - sdl.origin_x;
+                        evt->mouse_y = e.button.y * sdl.mouse_scale_y - sdl.origin_y;
                         evt->key_value = 0;
                         break;
 
@@ -184,6 +520,9 @@ uint8_t plat_core_key_input(input_event_t *evt) {
                         return 1;
 
                     case SDLK_RETURN:
+#ifdef RETROMATE_PERF
+                        plat_core_perf_input(e.key.timestamp);
+#endif
                         evt->code = INPUT_SELECT;
                         return 1;
 
@@ -216,6 +555,14 @@ uint8_t plat_core_key_input(input_event_t *evt) {
                             evt->code = INPUT_SAY;
                             return 1;
                         }
+                        break;
+
+#ifdef RETROMATE_PERF
+                    case SDLK_F3:
+                        // Drawn over the framebuffer, so nothing else redraws
+                        sdl.perf_overlay = !sdl.perf_overlay;
+                        break;
+#endif
                 }
                 break;
             }
@@ -285,8 +632,225 @@ uint8_t plat_core_mouse_to_menu_item(void) {
     return MENU_SELECT_NONE;
 }
 
+#ifdef RETROMATE_ENGINE
+/*-----------------------------------------------------------------------*/
+bool plat_core_engine_poll(void) {
+    bool stop;
+
+    SDL_LockMutex(sdl.engine_mutex);
+    stop = sdl.engine_quit || sdl.engine_searching != sdl.engine_serial;
+    SDL_UnlockMutex(sdl.engine_mutex);
+    return stop || SDL_TICKS_PASSED(SDL_GetTicks(), sdl.engine_deadline);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_engine_publish(const engine_result_t *result) {
+    SDL_LockMutex(sdl.engine_mutex);
+    if (sdl.engine_searching == sdl.engine_serial) {
+        sdl.engine_result = *result;
+        sdl.engine_result_new = true;
+    }
+    SDL_UnlockMutex(sdl.engine_mutex);
+}
+
+/*-----------------------------------------------------------------------*/
+bool plat_core_engine_result(engine_result_t *result) {
+    bool found;
+
+    SDL_LockMutex(sdl.engine_mutex);
+    found = sdl.engine_result_new;
+    if (found) {
+        *result = sdl.engine_result;
+        sdl.engine_result_new = false;
+    }
+    SDL_UnlockMutex(sdl.engine_mutex);
+    return found;
+}
+
+/*-----------------------------------------------------------------------*/
+// Only holds the lock for a copy, so the main loop never waits on a search
+void plat_core_engine_start(const position_t *position) {
+    SDL_LockMutex(sdl.engine_mutex);
+    sdl.engine_position = *position;
+    sdl.engine_pending = true;
+    sdl.engine_serial++;
+    sdl.engine_result_new = false;
+    SDL_CondSignal(sdl.engine_cond);
+    SDL_UnlockMutex(sdl.engine_mutex);
+}
+
+/*-----------------------------------------------------------------------*/
+// The search in progress sees the new serial at its next poll
+void plat_core_engine_stop(void) {
+    SDL_LockMutex(sdl.engine_mutex);
+    sdl.engine_pending = false;
+    sdl.engine_serial++;
+    sdl.engine_result_new = false;
+    SDL_UnlockMutex(sdl.engine_mutex);
+}
+#endif
+
+#ifdef RETROMATE_ARCHIVE
+/*-----------------------------------------------------------------------*/
+void plat_core_file_append(const char *path, const uint8_t *data, uint32_t size) {
+    archive_write_t *w = (archive_write_t *)malloc(sizeof(archive_write_t) + size);
+
+    if (!w) {
+        return;
+    }
+    w->next = NULL;
+    w->path = path;
+    w->size = size;
+    memcpy(w->data, data, size);
+    if (!sdl.archive_thread) {
+        // No writer, so it's written now
+        plat_core_archive_write(w);
+        return;
+    }
+    SDL_LockMutex(sdl.archive_mutex);
+    if (sdl.archive_tail) {
+        sdl.archive_tail->next = w;
+    } else {
+        sdl.archive_head = w;
+    }
+    sdl.archive_tail = w;
+    // Flush waits on the same cond, so all must wake
+    SDL_CondBroadcast(sdl.archive_cond);
+    SDL_UnlockMutex(sdl.archive_mutex);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_file_flush(void) {
+    if (!sdl.archive_thread) {
+        return;
+    }
+    SDL_LockMutex(sdl.archive_mutex);
+    while (sdl.archive_head || sdl.archive_busy) {
+        SDL_CondWait(sdl.archive_cond, sdl.archive_mutex);
+    }
+    SDL_UnlockMutex(sdl.archive_mutex);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_file_truncate(const char *path, uint32_t size) {
+#ifdef _WIN32
+    int fd = _open(path, _O_WRONLY | _O_BINARY);
+
+    if (fd >= 0) {
+        _chsize_s(fd, size);
+        _close(fd);
+    }
+#else
+    // A file that can't be cut keeps its tail, and appends go after it
+    if (truncate(path, size)) {
+        return;
+    }
+#endif
+}
+#endif
+
+#if defined(RETROMATE_BOOK) || defined(RETROMATE_ARCHIVE)
+/*-----------------------------------------------------------------------*/
+// The pages are read in as a lookup touches them, so a book of any size
+// opens at once
+const uint8_t *plat_core_file_map(const char *path, uint32_t *size) {
+    void *data;
+#ifdef _WIN32
+    HANDLE file, mapping;
+    DWORD high;
+
+    file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+    *size = GetFileSize(file, &high);
+    if (high || !*size) {
+        CloseHandle(file);
+        return NULL;
+    }
+    mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping) {
+        return NULL;
+    }
+    // The view keeps the mapping open
+    data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    return (const uint8_t *)data;
+#else
+    struct stat st;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &st) || !st.st_size || st.st_size > UINT32_MAX) {
+        close(fd);
+        return NULL;
+    }
+    *size = (uint32_t)st.st_size;
+    data = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return NULL;
+    }
+    // Binary searches jump about, so reading ahead is wasted
+    madvise(data, *size, MADV_RANDOM);
+    return (const uint8_t *)data;
+#endif
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_file_unmap(const uint8_t *data, uint32_t size) {
+#ifdef _WIN32
+    UNUSED(size);
+    UnmapViewOfFile(data);
+#else
+    munmap((void *)data, size);
+#endif
+}
+#endif
+
+#ifdef RETROMATE_PERF
+/*-----------------------------------------------------------------------*/
+uint64_t plat_core_perf_frequency(void) {
+    return SDL_GetPerformanceFrequency();
+}
+
+/*-----------------------------------------------------------------------*/
+uint64_t plat_core_perf_ticks(void) {
+    return SDL_GetPerformanceCounter();
+}
+#endif
+
 /*-----------------------------------------------------------------------*/
 void plat_core_shutdown(void) {
+#ifdef RETROMATE_ENGINE
+    if (sdl.engine_thread) {
+        SDL_LockMutex(sdl.engine_mutex);
+        sdl.engine_quit = true;
+        SDL_CondSignal(sdl.engine_cond);
+        SDL_UnlockMutex(sdl.engine_mutex);
+        SDL_WaitThread(sdl.engine_thread, NULL);
+        sdl.engine_thread = NULL;
+        SDL_DestroyCond(sdl.engine_cond);
+        SDL_DestroyMutex(sdl.engine_mutex);
+    }
+#endif
+#ifdef RETROMATE_ARCHIVE
+    if (sdl.archive_thread) {
+        // The writer empties the queue before it goes
+        SDL_LockMutex(sdl.archive_mutex);
+        sdl.archive_quit = true;
+        SDL_CondBroadcast(sdl.archive_cond);
+        SDL_UnlockMutex(sdl.archive_mutex);
+        SDL_WaitThread(sdl.archive_thread, NULL);
+        sdl.archive_thread = NULL;
+        SDL_DestroyCond(sdl.archive_cond);
+        SDL_DestroyMutex(sdl.archive_mutex);
+    }
+#endif
+
     SDL_StopTextInput();
 
     if (sdl.font) {
@@ -298,6 +862,18 @@ void plat_core_shutdown(void) {
         SDL_DestroyTexture(sdl.framebuffer);
     }
 
+    if(sdl.board_texture) {
+        SDL_DestroyTexture(sdl.board_texture);
+    }
+
+    if(sdl.piece_texture) {
+        SDL_DestroyTexture(sdl.piece_texture);
+    }
+
+    if(sdl.piece_surface) {
+        SDL_FreeSurface(sdl.piece_surface);
+    }
+
     if (sdl.renderer) {
         SDL_DestroyRenderer(sdl.renderer);
     }
@@ -307,4 +883,7 @@ void plat_core_shutdown(void) {
     }
 
     SDL_Quit();
+
+    free(sdl.history);
+    sdl.history = NULL;
 }
@@ -126,15 +126,31 @@ sdl_t sdl = {
     NULL,           // window;
     NULL,           // renderer;
     NULL,           // font;
+    0,              // character_width
+    0,              // character_height
+    0,              // output_w
+    0,              // output_h
+    0,              // origin_x
+    0,              // origin_y
+    1.0f,           // mouse_scale_x
+    1.0f,           // mouse_scale_y
     NULL,           // framebuffer;
+    NULL,           // piece_surface
     NULL,           // piece_texture;
+    0,              // piece_size
+    NULL,           // board_texture;
+    0,              // piece_texture_w
+    0,              // piece_texture_h
+    {},             // highlight[64]
     COLOR_WHITE,    // draw_color;
     COLOR_GREEN,    // text_bg_color
     {help_text0, help_text1},
     {help_text_len0, help_text_len1},
     {AS(help_text_len0), AS(help_text_len1)},
     -1,             // sockfd;
-    {},             // recv_buf[1025];
+    {},             // recv_buf[RECV_RING_SIZE + 1];
+    0,              // recv_head
+    {},             // terminal_spans[SCREEN_TEXT_HEIGHT]
     NULL            // receive_callback
 };
 
@@ -152,26 +168,272 @@ static char *strndup(const char *s, size_t n) {
 #endif
 
 /*-----------------------------------------------------------------------*/
-// The x, y are in Graphics space here
-static void plat_draw_piece(uint8_t piece, int screen_x, int screen_y) {
+// Where the piece is in assets/sdl2/pieces.png - white on the top row
+static uint8_t plat_draw_atlas_index(uint8_t piece) {
     uint8_t index = fics_letter_to_piece(piece) - 1;
     if (index & PIECE_WHITE) {
         index &= ~PIECE_WHITE;
     } else {
         index += 6;
     }
-    int sx = (index % 6) * 96; // Based on grid of assets/sdl2/pieces.png
-    int sy = (index / 6) * 96;
+    return index;
+}
+
+/*-----------------------------------------------------------------------*/
+// The x, y are in Graphics space here
+static void plat_draw_piece(uint8_t piece, int screen_x, int screen_y) {
+    uint8_t index = plat_draw_atlas_index(piece);
+    int sx = (index % 6) * PIECE_SIZE;
+    int sy = (index / 6) * PIECE_SIZE;
 
-    int ox = (SQUARE_DISPLAY_WIDTH - 96) / 2;
-    int oy = (SQUARE_DISPLAY_HEIGHT - 96) / 2;
+    int ox = (SQUARE_DISPLAY_WIDTH - PIECE_SIZE) / 2;
+    int oy = (SQUARE_DISPLAY_HEIGHT - PIECE_SIZE) / 2;
 
-    SDL_Rect src = {sx, sy, 96, 96};
-    SDL_Rect dst = {screen_x + ox, screen_y + oy, 96, 96};
+    SDL_Rect src = {sx, sy, PIECE_SIZE, PIECE_SIZE};
+    SDL_Rect dst = {screen_x + ox, screen_y + oy, PIECE_SIZE, PIECE_SIZE};
 
     SDL_RenderCopy(sdl.renderer, sdl.piece_texture, &src, &dst);
 }
 
+/*-----------------------------------------------------------------------*/
+// Draw the pieces on count squares, starting at position, as one batch
+static void plat_draw_pieces(uint8_t position, uint8_t count) {
+    static const int quad[6] = {0, 1, 2, 2, 1, 3};
+    SDL_Vertex vertices[64 * 4];
+    int indices[64 * 6];
+    int num_vertices = 0, num_indices = 0;
+    float du = (float)PIECE_SIZE / sdl.piece_texture_w;
+    float dv = (float)PIECE_SIZE / sdl.piece_texture_h;
+    int i;
+
+    for (; count; count--, position++) {
+        uint8_t piece = global.state.chess_board[position];
+        if (piece == '-') {
+            continue;
+        }
+        uint8_t index = plat_draw_atlas_index(piece);
+        float x = BOARD_START_X + (position & 7) * SQUARE_DISPLAY_WIDTH + (SQUARE_DISPLAY_WIDTH - PIECE_SIZE) / 2;
+        float y = BOARD_START_Y + (position / 8) * SQUARE_DISPLAY_HEIGHT + (SQUARE_DISPLAY_HEIGHT - PIECE_SIZE) / 2;
+        float u = (index % 6) * du;
+        float v = (index / 6) * dv;
+        SDL_Vertex *corner = &vertices[num_vertices];
+
+        // Corners 0..3 are top-left, top-right, bottom-left, bottom-right
+        for (i = 0; i < 4; i++) {
+            corner[i].position.x = x + (i & 1) * PIECE_SIZE;
+            corner[i].position.y = y + (i >> 1) * PIECE_SIZE;
+            corner[i].color = sdl2_palette[COLOR_WHITE];
+            corner[i].tex_coord.x = u + (i & 1) * du;
+            corner[i].tex_coord.y = v + (i >> 1) * dv;
+        }
+        for (i = 0; i < 6; i++) {
+            indices[num_indices++] = num_vertices + quad[i];
+        }
+        num_vertices += 4;
+    }
+
+    if (num_indices) {
+        SDL_RenderGeometry(sdl.renderer, sdl.piece_texture, vertices, num_vertices, indices, num_indices);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// The highlights are not part of the framebuffer.  They go on top of it when
+// it is presented, so removing one doesn't need the square redrawn
+static void plat_draw_highlights(void) {
+    SDL_Rect bars[2][64 * 2];
+    int num_bars[2] = {0, 0};
+    SDL_Rect menu = {
+        global.view.mc.x * CHARACTER_WIDTH,
+        global.view.mc.y * CHARACTER_HEIGHT,
+        global.view.mc.w * CHARACTER_WIDTH,
+        global.view.mc.h * CHARACTER_HEIGHT
+    };
+    bool menu_visible = !(global.view.mc.df & MENU_DRAW_HIDDEN) && (global.view.mc.m || global.view.mc.nm);
+    int i;
+
+    for (i = 0; i < 64; i++) {
+        if (!sdl.highlight[i]) {
+            continue;
+        }
+        SDL_Rect square = {
+            BOARD_START_X + (i & 7) * SQUARE_DISPLAY_WIDTH,
+            BOARD_START_Y + (i / 8) * SQUARE_DISPLAY_HEIGHT,
+            SQUARE_DISPLAY_WIDTH,
+            SQUARE_DISPLAY_HEIGHT
+        };
+        // Don't draw over the menu
+        if (menu_visible && SDL_HasIntersection(&square, &menu)) {
+            continue;
+        }
+        uint8_t color = sdl.highlight[i] - 1;
+        SDL_Rect *bar = &bars[color][num_bars[color]];
+        // A bar a character wide on the left and right edge of the square
+        bar[0].x = sdl.origin_x + square.x;
+        bar[1].x = sdl.origin_x + square.x + SQUARE_DISPLAY_WIDTH - CHARACTER_WIDTH;
+        bar[0].y = bar[1].y = sdl.origin_y + square.y;
+        bar[0].w = bar[1].w = CHARACTER_WIDTH;
+        bar[0].h = bar[1].h = SQUARE_DISPLAY_HEIGHT;
+        num_bars[color] += 2;
+    }
+
+    for (i = 0; i < 2; i++) {
+        if (num_bars[i]) {
+            SDL_Color c = sdl2_palette[i == HCOLOR_VALID ? COLOR_BLUE : COLOR_GREEN];
+            SDL_SetRenderDrawColor(sdl.renderer, c.r, c.g, c.b, c.a);
+            SDL_RenderFillRects(sdl.renderer, bars[i], num_bars[i]);
+        }
+    }
+}
+
+#ifdef RETROMATE_PERF
+/*-----------------------------------------------------------------------*/
+// The frame timings, in ms, and counters, top right.  Like the highlights,
+// it goes on top of the framebuffer when presented
+static void plat_draw_perf_overlay(void) {
+    char line[48];
+    int i, y = sdl.origin_y;
+
+    for (i = -1; i < PERF_PHASES + PERF_SPANS + PERF_COUNTERS; i++) {
+        if (i < 0) {
+            snprintf(line, sizeof(line), "%-14s %7s %7s %7s", "ms", "last", "p50", "p99");
+        } else if (i < PERF_PHASES + PERF_SPANS) {
+            perf_histogram_t *h = i < PERF_PHASES ? &perf.phases[i] : &perf.spans[i - PERF_PHASES];
+            snprintf(line, sizeof(line), "%-14s %7.2f %7.2f %7.2f",
+                     i < PERF_PHASES ? perf_phase_names[i] : perf_span_names[i - PERF_PHASES],
+                     h->last_us / 1000.0, perf_percentile(h, 50) / 1000.0, perf_percentile(h, 99) / 1000.0);
+        } else {
+            snprintf(line, sizeof(line), "%-14s %23llu", perf_counter_names[i - PERF_PHASES - PERF_SPANS],
+                     (unsigned long long)perf.counters[i - PERF_PHASES - PERF_SPANS]);
+        }
+        SDL_Surface *surface = TTF_RenderText_Shaded(sdl.font, line, sdl2_palette[COLOR_YELLOW], sdl2_palette[COLOR_BLACK]);
+        if (!surface) {
+            return;
+        }
+        SDL_Texture *texture = SDL_CreateTextureFromSurface(sdl.renderer, surface);
+        SDL_Rect dest = {sdl.origin_x + SCREEN_DISPLAY_WIDTH - surface->w, y, surface->w, surface->h};
+        SDL_RenderCopy(sdl.renderer, texture, NULL, &dest);
+        y += surface->h;
+        SDL_FreeSurface(surface);
+        SDL_DestroyTexture(texture);
+    }
+}
+#endif
+
+/*-----------------------------------------------------------------------*/
+static int plat_draw_compare_ticks(const void *a, const void *b) {
+    Uint64 ta = *(const Uint64 *)a;
+    Uint64 tb = *(const Uint64 *)b;
+    return (ta > tb) - (ta < tb);
+}
+
+/*-----------------------------------------------------------------------*/
+// Time full board refreshes.  Run with SDL_VIDEODRIVER=dummy for a headless,
+// software renderer number
+void plat_draw_benchmark(int frames) {
+    Uint64 *ticks;
+    Uint64 start, total = 0;
+    double ms;
+    int i;
+
+    if (frames <= 0 || !(ticks = (Uint64 *)malloc(frames * sizeof(Uint64)))) {
+        return;
+    }
+    memcpy(global.state.chess_board, "rnbqkbnrpppppppp--------------------------------PPPPPPPPRNBQKBNR", 64);
+
+    for (i = 0; i < frames; i++) {
+        start = SDL_GetPerformanceCounter();
+        plat_draw_board();
+        plat_draw_highlight(i & 63, HCOLOR_SELECTED);
+        plat_draw_update();
+        ticks[i] = SDL_GetPerformanceCounter() - start;
+        total += ticks[i];
+    }
+
+    qsort(ticks, frames, sizeof(Uint64), plat_draw_compare_ticks);
+    ms = 1000.0 / SDL_GetPerformanceFrequency();
+    printf("%d frames: avg %.3f ms, p50 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+           frames, total * ms / frames, ticks[frames / 2] * ms, ticks[frames * 99 / 100] * ms, ticks[frames - 1] * ms);
+    free(ticks);
+}
+
+/*-----------------------------------------------------------------------*/
+// Render the empty board and its labels to the board texture.  Called again
+// whenever the layout changes
+void plat_draw_cache_board(void) {
+    int i;
+
+    if (sdl.board_texture) {
+        SDL_DestroyTexture(sdl.board_texture);
+    }
+    sdl.board_texture = SDL_CreateTexture(
+                            sdl.renderer,
+                            SDL_PIXELFORMAT_RGBA8888,
+                            SDL_TEXTUREACCESS_TARGET,
+                            BOARD_TEXTURE_WIDTH,
+                            BOARD_TEXTURE_HEIGHT
+                        );
+    if (!sdl.board_texture) {
+        printf("error: board texture is null\n");
+        exit(1);
+    }
+    // Around the labels, what's in the framebuffer shows through
+    SDL_SetTextureBlendMode(sdl.board_texture, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderTarget(sdl.renderer, sdl.board_texture);
+    SDL_SetRenderDrawColor(sdl.renderer, 0, 0, 0, 0);
+    SDL_RenderClear(sdl.renderer);
+
+    for (i = 0; i < 64; i++) {
+        uint8_t y = i / 8, x = i & 7;
+        bool black_or_white = !((x & 1) ^ (y & 1));
+        SDL_Color draw_color = sdl2_palette[black_or_white ? COLOR_WHITE : COLOR_GRAY2];
+        SDL_SetRenderDrawColor(sdl.renderer, draw_color.r, draw_color.g, draw_color.b, draw_color.a);
+
+        SDL_Rect rect1 = {
+            .x = BOARD_START_X + x * SQUARE_DISPLAY_WIDTH,
+            .y = BOARD_START_Y + y * SQUARE_DISPLAY_HEIGHT,
+            .w = SQUARE_DISPLAY_WIDTH,
+            .h = SQUARE_DISPLAY_HEIGHT
+        };
+        SDL_RenderFillRect(sdl.renderer, &rect1);
+    }
+
+    // Column labels (a-h)
+    for (int col = 0; col < 8; col++) {
+        char label[2] = { 'a' + col, '\0' };
+        SDL_Surface *surf = TTF_RenderText_Solid(sdl.font, label, sdl2_palette[COLOR_WHITE]);
+        SDL_Texture *tex = SDL_CreateTextureFromSurface(sdl.renderer, surf);
+
+        SDL_Rect dest = {
+            .x = CHARACTER_WIDTH + 2 + col * SQUARE_DISPLAY_WIDTH + (SQUARE_DISPLAY_WIDTH - CHARACTER_WIDTH) / 2,
+            .y = 8 * SQUARE_DISPLAY_HEIGHT,
+            .w = CHARACTER_WIDTH,
+            .h = surf->h
+        };
+        SDL_RenderCopy(sdl.renderer, tex, NULL, &dest);
+        SDL_FreeSurface(surf);
+        SDL_DestroyTexture(tex);
+    }
+
+    // Row labels (8-1)
+    for (int row = 0; row < 8; row++) {
+        char label[2] = { '8' - row, '\0' };
+        SDL_Surface *surf = TTF_RenderText_Solid(sdl.font, label, sdl2_palette[COLOR_WHITE]);
+        SDL_Texture *tex = SDL_CreateTextureFromSurface(sdl.renderer, surf);
+        SDL_Rect dest = {
+            .x = 0,
+            .y = row * SQUARE_DISPLAY_HEIGHT + (SQUARE_DISPLAY_HEIGHT - CHARACTER_WIDTH) / 2,
+            .w = CHARACTER_WIDTH,
+            .h = surf->h
+        };
+        SDL_RenderCopy(sdl.renderer, tex, NULL, &dest);
+        SDL_FreeSurface(surf);
+        SDL_DestroyTexture(tex);
+    }
+
+    SDL_SetRenderTarget(sdl.renderer, sdl.framebuffer);
+}
+
 /*-----------------------------------------------------------------------*/
 void plat_draw_background() {
     uint8_t t, l, b, r;
@@ -225,46 +487,19 @@ void plat_draw_background() {
 /*-----------------------------------------------------------------------*/
 // Draw the chess board and possibly clear the log section
 void plat_draw_board_accoutrements() {
-    // Column labels (a-h)
-    for (int col = 0; col < 8; col++) {
-        char label[2] = { 'a' + col, '\0' };
-        SDL_Surface *surf = TTF_RenderText_Solid(sdl.font, label, sdl2_palette[COLOR_WHITE]);
-        SDL_Texture *tex = SDL_CreateTextureFromSurface(sdl.renderer, surf);
-
-        SDL_Rect dest = {
-            .x = CHARACTER_WIDTH + 2 + col * SQUARE_DISPLAY_WIDTH + (SQUARE_DISPLAY_WIDTH - CHARACTER_WIDTH) / 2,
-            .y = 8 * SQUARE_DISPLAY_HEIGHT,
-            .w = CHARACTER_WIDTH,
-            .h = surf->h
-        };
-        SDL_RenderCopy(sdl.renderer, tex, NULL, &dest);
-        SDL_FreeSurface(surf);
-        SDL_DestroyTexture(tex);
-    }
-
-    // Row labels (8-1)
-    for (int row = 0; row < 8; row++) {
-        char label[2] = { '8' - row, '\0' };
-        SDL_Surface *surf = TTF_RenderText_Solid(sdl.font, label, sdl2_palette[COLOR_WHITE]);
-        SDL_Texture *tex = SDL_CreateTextureFromSurface(sdl.renderer, surf);
-        SDL_Rect dest = {
-            .x = 0,
-            .y = row * SQUARE_DISPLAY_HEIGHT + (SQUARE_DISPLAY_HEIGHT - CHARACTER_WIDTH) / 2,
-            .w = CHARACTER_WIDTH,
-            .h = surf->h
-        };
-        SDL_RenderCopy(sdl.renderer, tex, NULL, &dest);
-        SDL_FreeSurface(surf);
-        SDL_DestroyTexture(tex);
-    }
+    // Row labels left of the board and column labels below it
+    SDL_Rect rows = {0, 0, BOARD_START_X, BOARD_DISPLAY_HEIGHT};
+    SDL_Rect cols = {0, BOARD_DISPLAY_HEIGHT, BOARD_TEXTURE_WIDTH, CHARACTER_HEIGHT};
+    SDL_RenderCopy(sdl.renderer, sdl.board_texture, &rows, &rows);
+    SDL_RenderCopy(sdl.renderer, sdl.board_texture, &cols, &cols);
 }
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_board() {
-    plat_draw_board_accoutrements();
-    for (int i = 0; i < 64; i++) {
-        plat_draw_square(i);
-    }
+    SDL_Rect board = {0, 0, BOARD_TEXTURE_WIDTH, BOARD_TEXTURE_HEIGHT};
+    SDL_RenderCopy(sdl.renderer, sdl.board_texture, NULL, &board);
+    plat_draw_pieces(0, 64);
+    memset(sdl.highlight, 0, sizeof(sdl.highlight));
     global.view.refresh = 0;
 }
 
@@ -280,6 +515,14 @@ void plat_draw_clear_input_line(bool active) {
 /*-----------------------------------------------------------------------*/
 void plat_draw_clear_statslog_area(uint8_t row) {
     plat_draw_rect(plat_core_get_status_x(), row, global.view.info_panel.cols, plat_core_get_rows() - row, COLOR_GREEN);
+    // The engine and book rows are at the bottom of the area, so they're
+    // drawn again
+#ifdef RETROMATE_ENGINE
+    engine.panel.modified = true;
+#endif
+#ifdef RETROMATE_BOOK
+    book.panel.modified = true;
+#endif
 }
 
 /*-----------------------------------------------------------------------*/
@@ -287,37 +530,25 @@ void plat_draw_clrscr() {
     SDL_Color clear_color = sdl2_palette[COLOR_GREEN];
     SDL_SetRenderDrawColor(sdl.renderer, clear_color.r, clear_color.g, clear_color.b, clear_color.a);
     SDL_RenderClear(sdl.renderer);
+    memset(sdl.highlight, 0, sizeof(sdl.highlight));
 }
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_highlight(uint8_t position, uint8_t color) {
-    uint8_t y = (position / 8) * SQUARE_TEXT_HEIGHT;
-    uint8_t x = (position & 7) * SQUARE_TEXT_WIDTH;
-    color = color ? COLOR_BLUE : COLOR_GREEN;
-
-    plat_draw_rect(x + 1, y, 1, SQUARE_TEXT_HEIGHT, color);
-    plat_draw_rect(x + SQUARE_TEXT_WIDTH, y, 1, SQUARE_TEXT_HEIGHT, color);
+    // Drawn by plat_draw_update
+    sdl.highlight[position] = color + 1;
 }
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool use_color) {
     int i;
-    char *log_end = log->buffer + log->buffer_size;
-    char *log_render = log->buffer;
-    if (log->size >= log->rows) {
-        log_render += log->cols * log->head;
-    }
     log->modified = false;
     // This will only affect the status, the terminal is text
     sdl.draw_color = COLOR_BLACK;
     sdl.text_bg_color = COLOR_GREEN;
 
     for (i = 0; i < log->size; ++i) {
-        plat_draw_text(x, y++, log_render, log->cols);
-        log_render += log->cols;
-        if (log_render >= log_end) {
-            log_render = log->buffer;
-        }
+        plat_draw_text(x, y++, log_row(log, i), log->cols);
     }
 }
 
@@ -371,23 +602,15 @@ void plat_draw_splash_screen() {
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_square(uint8_t position) {
-    uint8_t y = position / 8, x = position & 7;
-    bool black_or_white = !((x & 1) ^ (y & 1));
-    SDL_Color draw_color = sdl2_palette[black_or_white ? COLOR_WHITE : COLOR_GRAY2];
-    SDL_SetRenderDrawColor(sdl.renderer, draw_color.r, draw_color.g, draw_color.b, draw_color.a);
-
-    SDL_Rect rect1 = {
-        .x = BOARD_START_X + x * SQUARE_DISPLAY_WIDTH,
-        .y = y * SQUARE_DISPLAY_HEIGHT,
+    SDL_Rect square = {
+        .x = BOARD_START_X + (position & 7) * SQUARE_DISPLAY_WIDTH,
+        .y = BOARD_START_Y + (position / 8) * SQUARE_DISPLAY_HEIGHT,
         .w = SQUARE_DISPLAY_WIDTH,
         .h = SQUARE_DISPLAY_HEIGHT
     };
-    SDL_RenderFillRect(sdl.renderer, &rect1);
-
-    uint8_t piece = global.state.chess_board[position++];
-    if (piece != '-') {
-        plat_draw_piece(piece, BOARD_START_X + x * SQUARE_DISPLAY_WIDTH, y * SQUARE_DISPLAY_HEIGHT);
-    }
+    SDL_RenderCopy(sdl.renderer, sdl.board_texture, &square, &square);
+    plat_draw_pieces(position, 1);
+    sdl.highlight[position] = 0;
 }
 
 /*-----------------------------------------------------------------------*/
@@ -404,6 +627,7 @@ void plat_draw_text(uint8_t x, uint8_t y, const char *text, uint8_t len) {
         }
 
         SDL_Texture *texture = SDL_CreateTextureFromSurface(sdl.renderer, text_surface);
+        PERF_COUNT(PERF_TEXT_TEXTURES, 1);
         SDL_Rect dest = {
             .x = x * CHARACTER_WIDTH,
             .y = y * CHARACTER_HEIGHT,
@@ -425,6 +649,7 @@ uint8_t plat_draw_ui_help_callback(menu_t *m, void *data) {
 
     sdl.draw_color = COLOR_WHITE;
     sdl.text_bg_color = COLOR_BLUE;
+    memset(sdl.highlight, 0, sizeof(sdl.highlight));
 
     for(int i=0; i < 2; i++) {
         h =  sdl.help_text_num_lines[i]+2;
@@ -445,12 +670,29 @@ uint8_t plat_draw_ui_help_callback(menu_t *m, void *data) {
 
 /*-----------------------------------------------------------------------*/
 void plat_draw_update(void) {
+    // The framebuffer is made at the window's pixel size, so it goes 1:1,
+    // centered, with no scaling
+    SDL_Rect screen = {sdl.origin_x, sdl.origin_y, SCREEN_DISPLAY_WIDTH, SCREEN_DISPLAY_HEIGHT};
     // Remove sdl.framebuffer as the drawing target
     SDL_SetRenderTarget(sdl.renderer, NULL);
+    SDL_SetRenderDrawColor(sdl.renderer, 0, 0, 0, 0xff);
+    SDL_RenderClear(sdl.renderer);
     // Copy the texture (sdl.framebuffer) to the window
-    SDL_RenderCopy(sdl.renderer, sdl.framebuffer, NULL, NULL);
+    SDL_RenderCopy(sdl.renderer, sdl.framebuffer, NULL, &screen);
+    // Cursor and selection go on top, but not on top of the terminal
+    if (!global.view.terminal_active) {
+        plat_draw_highlights();
+    }
+#ifdef RETROMATE_PERF
+    if (sdl.perf_overlay) {
+        plat_draw_perf_overlay();
+    }
+#endif
     // present the window
+    PERF_SPAN_BEGIN(PERF_SPAN_PRESENT);
     SDL_RenderPresent(sdl.renderer);
+    PERF_SPAN_END(PERF_SPAN_PRESENT);
+    PERF_MOVE(PERF_MOVE_SHOWN);
     // Set sdl.framebuffer as the target for draw commands, again
     SDL_SetRenderTarget(sdl.renderer, sdl.framebuffer);
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <netdb.h>
+#include <netinet/tcp.h>    // TCP_NODELAY
 #include <poll.h>
 #include <string.h>
 #include <unistd.h>
@@ -86,6 +87,9 @@ void plat_net_connect(const char *server_name, int server_port) {
     int flags = fcntl(sdl.sockfd, F_GETFL, 0);
     fcntl(sdl.sockfd, F_SETFL, flags | O_NONBLOCK);
 #endif
+    // Lines are small and a move shouldn't wait for Nagle to send it
+    int nodelay = 1;
+    setsockopt(sdl.sockfd, IPPROTO_TCP, TCP_NODELAY, (const char *)&nodelay, sizeof(nodelay));
 
     sdl.receive_callback = fics_tcp_recv;
     log_add_line(&global.view.terminal, "Logging in, please be patient", -1);
@@ -140,11 +144,24 @@ bool plat_net_update() {
 #else
         if (pfd.revents & POLLIN) {
 #endif
-            int len = recv(sdl.sockfd, sdl.recv_buf, sizeof(sdl.recv_buf) - 1, 0);
+            unsigned char *chunk;
+            int len;
+            if (sdl.recv_head + RECV_CHUNK_SIZE > RECV_RING_SIZE) {
+                // About to overwrite text the terminal may still point at
+                log_commit(&global.view.terminal);
+                sdl.recv_head = 0;
+            }
+            chunk = &sdl.recv_buf[sdl.recv_head];
+            len = recv(sdl.sockfd, chunk, RECV_CHUNK_SIZE, 0);
             if (len > 0) {
-                sdl.recv_buf[len] = '\0';
+                PERF_COUNT(PERF_BYTES_RECEIVED, len);
+                chunk[len] = '\0';
+                // Keep the '\0' so the callback can still treat chunk as a string
+                sdl.recv_head += len + 1;
                 if (sdl.receive_callback) {
-                    sdl.receive_callback(sdl.recv_buf, len);
+                    PERF_SPAN_BEGIN(PERF_SPAN_RECV);
+                    sdl.receive_callback(chunk, len);
+                    PERF_SPAN_END(PERF_SPAN_RECV);
                 }
                 return 1;
             } else if (len == 0) {
@@ -183,10 +200,13 @@ void plat_net_send(const char *text) {
 #endif
         return;
     }
-    int len = strlen(text);
+    int len = MIN((int)strlen(text), SEND_BUFFER_SIZE - 1);
     log_add_line(&global.view.terminal, text, len);
-    send(sdl.sockfd, text, len, 0);
-    send(sdl.sockfd, "\n", 1, 0);
+    // With TCP_NODELAY each send is a packet, so the line and its \n go together
+    memcpy(sdl.send_buffer, text, len);
+    sdl.send_buffer[len++] = '\n';
+    send(sdl.sockfd, sdl.send_buffer, len, 0);
+    PERF_COUNT(PERF_BYTES_SENT, len);
 }
 
 /*-----------------------------------------------------------------------*/
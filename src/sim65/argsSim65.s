@@ -0,0 +1,12 @@
+;
+; argsSim65.s
+; RetroMate
+;
+; Created by Stefan Wessels, 2025.
+; This is free and unencumbered software released into the public domain.
+;
+; main() takes no arguments, so cc65 doesn't pull in the constructor that
+; fills __argc and __argv.  The replay needs the capture name from them
+;
+
+.forceimport initmainargs
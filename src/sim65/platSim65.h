@@ -0,0 +1,55 @@
+/*
+ *  platSim65.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#ifndef _PLATSIM65_H_
+#define _PLATSIM65_H_
+
+#include <stdio.h>      // FILE
+
+/*-----------------------------------------------------------------------*/
+// Nothing is shown, but the shared code lays out for this size
+#define SCREEN_TEXT_WIDTH       80
+#define SCREEN_TEXT_HEIGHT      25
+#define SQUARE_TEXT_WIDTH       8
+
+// sim65 peripheral counters (cc65 2.19+).  Writing 1 to the latch freezes all
+// the counters, 0 lets them run.  Counter 0 is CPU clock cycles
+#define SIM65_COUNTER_LATCH     (*(volatile uint8_t *)0xFFC0)
+#define SIM65_COUNTER_SELECT    (*(volatile uint8_t *)0xFFC1)
+#define SIM65_COUNTER_VALUE     (*(volatile uint32_t *)0xFFC2)  // Low 32 of 64 bits
+#define SIM65_COUNTER_CYCLES    0x00
+
+// Capture lines that start with # are directives, not server data
+#define REPLAY_LINE_MAX         512
+
+// Where fics_tcp_recv spent its cycles, by the kind of line it was given
+enum {
+    REPLAY_KIND_LOGIN,              // Anything before the in-game parser is on
+    REPLAY_KIND_STYLE12,            // Board updates
+    REPLAY_KIND_OTHER,              // All other in-game text
+    REPLAY_KIND_COUNT,
+};
+
+typedef struct _replay {
+    FILE *capture;
+    const char *capture_name;
+    uint16_t line_number;
+    uint16_t failures;
+    uint16_t checks;
+    bool selected;                  // Play Online was "pressed"
+    uint32_t cycles[REPLAY_KIND_COUNT];
+    uint16_t calls[REPLAY_KIND_COUNT];
+    uint16_t bytes_sent;
+    char last_sent[80];
+    char line[REPLAY_LINE_MAX];
+} replay_t;
+
+extern replay_t replay;
+
+#endif // _PLATSIM65_H_
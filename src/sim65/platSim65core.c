@@ -0,0 +1,155 @@
+/*
+ *  platSim65core.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h> // exit, malloc
+#include <string.h> // memcpy
+
+#include "../global.h"
+
+#include "platSim65.h"
+
+// callmain (cc65) fills these from the sim65 command line
+extern int _argc;
+extern char **_argv;
+
+replay_t replay;
+
+static const char *replay_kind_name[REPLAY_KIND_COUNT] = {
+    "login",
+    "style 12",
+    "other",
+};
+
+/*-----------------------------------------------------------------------*/
+void plat_core_active_term(bool active) {
+    global.view.terminal_active = active;
+}
+
+/*-----------------------------------------------------------------------*/
+// The replay always starts from the defaults, so its checks hold
+bool plat_core_config_load(void *data, uint8_t size) {
+    UNUSED(data);
+    UNUSED(size);
+    return false;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_config_save(const void *data, uint8_t size) {
+    UNUSED(data);
+    UNUSED(size);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_copy_ascii_to_display(void *dest, const void *src, size_t n) {
+    memcpy(dest, src, n);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_exit() {
+    printf("%s:%u: fatal error\n", replay.capture_name, replay.line_number);
+    exit(1);
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_core_get_cols(void) {
+    return SCREEN_TEXT_WIDTH;
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_core_get_rows(void) {
+    return SCREEN_TEXT_HEIGHT;
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_core_get_status_x(void) {
+    // The accoutrements (1..8) + board + 1 extra space
+    return 2 + SQUARE_TEXT_WIDTH * 8;
+}
+
+/*-----------------------------------------------------------------------*/
+const char *plat_core_history_get(uint16_t slot) {
+    UNUSED(slot);
+    return NULL;
+}
+
+/*-----------------------------------------------------------------------*/
+// Nothing is shown, so nothing is kept
+uint16_t plat_core_history_init(void) {
+    return 0;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_history_put(uint16_t slot, const char *row) {
+    UNUSED(slot);
+    UNUSED(row);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_init() {
+    if (_argc < 2) {
+        printf("usage: sim65 -c %s capture.fics\n", _argv[0]);
+        exit(1);
+    }
+    replay.capture_name = _argv[1];
+}
+
+/*-----------------------------------------------------------------------*/
+// The only key press is Play Online, then the capture drives everything
+uint8_t plat_core_key_input(input_event_t *evt) {
+    evt->code = INPUT_NONE;
+    if (!replay.selected) {
+        replay.selected = true;
+        evt->code = INPUT_SELECT;
+        return 1;
+    }
+    return 0;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_key_wait_any() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_core_log_free_mem(char *mem) {
+    free(mem);
+}
+
+/*-----------------------------------------------------------------------*/
+char *plat_core_log_malloc(unsigned int size) {
+    return malloc(size);
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_core_mouse_to_cursor(void) {
+    return MOUSE_HIT_NONE;
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_core_mouse_to_menu_item(void) {
+    return MOUSE_HIT_NONE;
+}
+
+/*-----------------------------------------------------------------------*/
+// Report, and the exit code is what makes the _test target pass or fail
+void plat_core_shutdown() {
+    uint8_t kind;
+
+    printf("%s: %u checks, %u failed, %u bytes sent\n", replay.capture_name, replay.checks, replay.failures, replay.bytes_sent);
+    for (kind = 0; kind < REPLAY_KIND_COUNT; kind++) {
+        if (replay.calls[kind]) {
+            printf("  fics_tcp_recv %-8s %5u calls %9lu cycles %7lu per call\n",
+                   replay_kind_name[kind],
+                   replay.calls[kind],
+                   (unsigned long)replay.cycles[kind],
+                   (unsigned long)(replay.cycles[kind] / replay.calls[kind]));
+        }
+    }
+    exit(replay.failures ? 1 : 0);
+}
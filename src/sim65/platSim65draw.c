@@ -0,0 +1,114 @@
+/*
+ *  platSim65draw.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include "../global.h"
+
+#include "platSim65.h"
+
+// Nothing is drawn - the replay only checks state - but the menu code still
+// maps its colors
+uint8_t plat_mc2pc[9] = {
+    0,                      // MENU_COLOR_BACKGROUND
+    1,                      // MENU_COLOR_FRAME
+    2,                      // MENU_COLOR_TITLE
+    3,                      // MENU_COLOR_ITEM
+    4,                      // MENU_COLOR_CYCLE
+    5,                      // MENU_COLOR_CALLBACK
+    6,                      // MENU_COLOR_SUBMENU
+    7,                      // MENU_COLOR_SELECTED
+    8,                      // MENU_COLOR_DISABLED
+};
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_background() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_board_accoutrements() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_board() {
+    global.view.refresh = 0;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_clear_input_line(bool active) {
+    UNUSED(active);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_clear_statslog_area(uint8_t row) {
+    UNUSED(row);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_clrscr() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_highlight(uint8_t position, uint8_t color) {
+    UNUSED(position);
+    UNUSED(color);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_log(tLog *log, uint8_t x, uint8_t y, bool use_color) {
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(use_color);
+    log->modified = false;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_rect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t color) {
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(w);
+    UNUSED(h);
+    UNUSED(color);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_set_color(uint8_t color) {
+    UNUSED(color);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_set_text_bg_color(uint8_t color) {
+    UNUSED(color);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_splash_screen() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_square(uint8_t position) {
+    UNUSED(position);
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_text(uint8_t x, uint8_t y, const char *text, uint8_t len) {
+    UNUSED(x);
+    UNUSED(y);
+    UNUSED(text);
+    UNUSED(len);
+}
+
+/*-----------------------------------------------------------------------*/
+uint8_t plat_draw_ui_help_callback(menu_t *m, void *data) {
+    UNUSED(m);
+    UNUSED(data);
+    return MENU_DRAW_REDRAW;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_draw_update(void) {
+}
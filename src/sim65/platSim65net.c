@@ -0,0 +1,141 @@
+/*
+ *  platSim65net.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../global.h"
+
+#include "platSim65.h"
+
+// Capture directives.  The rest of the line is what's expected
+#define REPLAY_EXPECT_BOARD     "#expect-board "    // 64 squares, a8 to h1
+#define REPLAY_EXPECT_MOVE      "#expect-move "     // global.frame.previous_move
+#define REPLAY_EXPECT_ACTIVE    "#expect-active "   // 0 or 1
+#define REPLAY_EXPECT_SENT      "#expect-sent "     // The last plat_net_send
+
+                                    // "<12>"
+#define REPLAY_STYLE12          "\x3c\x31\x32\x3e"
+
+/*-----------------------------------------------------------------------*/
+static uint32_t plat_net_cycles(void) {
+    SIM65_COUNTER_LATCH = 0;
+    SIM65_COUNTER_LATCH = 1;
+    return SIM65_COUNTER_VALUE;
+}
+
+/*-----------------------------------------------------------------------*/
+static void plat_net_expect(bool pass, const char *expected, const char *actual) {
+    replay.checks++;
+    if (!pass) {
+        replay.failures++;
+        printf("%s:%u: expected \"%s\" got \"%s\"\n", replay.capture_name, replay.line_number, expected, actual);
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+static void plat_net_directive(char *line) {
+    char *value;
+    char *end = line + strlen(line);
+
+    // Drop the line end
+    while (end > line && (end[-1] == '\n' || end[-1] == '\r')) {
+        *--end = '\0';
+    }
+    if (0 == strncmp(line, REPLAY_EXPECT_BOARD, sizeof(REPLAY_EXPECT_BOARD) - 1)) {
+        value = line + sizeof(REPLAY_EXPECT_BOARD) - 1;
+        plat_net_expect(0 == strncmp(global.state.chess_board, value, 64), value, global.state.chess_board);
+    } else if (0 == strncmp(line, REPLAY_EXPECT_MOVE, sizeof(REPLAY_EXPECT_MOVE) - 1)) {
+        value = line + sizeof(REPLAY_EXPECT_MOVE) - 1;
+        plat_net_expect(0 == strcmp(global.frame.previous_move, value), value, global.frame.previous_move);
+    } else if (0 == strncmp(line, REPLAY_EXPECT_ACTIVE, sizeof(REPLAY_EXPECT_ACTIVE) - 1)) {
+        value = line + sizeof(REPLAY_EXPECT_ACTIVE) - 1;
+        plat_net_expect((*value == '1') == global.state.game_active, value, global.state.game_active ? "1" : "0");
+    } else if (0 == strncmp(line, REPLAY_EXPECT_SENT, sizeof(REPLAY_EXPECT_SENT) - 1)) {
+        value = line + sizeof(REPLAY_EXPECT_SENT) - 1;
+        plat_net_expect(0 == strcmp(replay.last_sent, value), value, replay.last_sent);
+    }
+    // Anything else starting with # is a comment
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_init() {
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_connect(const char *server_name, int server_port) {
+    UNUSED(server_name);
+    UNUSED(server_port);
+
+    replay.capture = fopen(replay.capture_name, "r");
+    if (!replay.capture) {
+        app_error(true, "Can't open the capture");
+    }
+    replay.line_number = 0;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_disconnect() {
+    if (replay.capture) {
+        fclose(replay.capture);
+        replay.capture = NULL;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+// Each capture line arrives as its own packet, one per frame
+bool plat_net_update() {
+    uint8_t kind;
+    uint32_t start;
+    int len;
+
+    if (!replay.capture) {
+        return 0;
+    }
+    if (!fgets(replay.line, REPLAY_LINE_MAX, replay.capture)) {
+        // The whole capture played, so the run is done
+        plat_net_disconnect();
+        global.app.quit = true;
+        return 0;
+    }
+    replay.line_number++;
+
+    if (replay.line[0] == '#') {
+        plat_net_directive(replay.line);
+        return 0;
+    }
+
+    if (global.app.state != APP_STATE_ONLINE) {
+        kind = REPLAY_KIND_LOGIN;
+    } else if (0 == strncmp(replay.line, REPLAY_STYLE12, sizeof(REPLAY_STYLE12) - 1)) {
+        kind = REPLAY_KIND_STYLE12;
+    } else {
+        kind = REPLAY_KIND_OTHER;
+    }
+
+    len = strlen(replay.line);
+    SIM65_COUNTER_SELECT = SIM65_COUNTER_CYCLES;
+    start = plat_net_cycles();
+    fics_tcp_recv((const unsigned char *)replay.line, len);
+    replay.cycles[kind] += plat_net_cycles() - start;
+    replay.calls[kind]++;
+    return 0;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_send(const char *text) {
+    log_add_line(&global.view.terminal, text, -1);
+    strncpy(replay.last_sent, text, sizeof(replay.last_sent) - 1);
+    replay.bytes_sent += strlen(text) + 1;
+}
+
+/*-----------------------------------------------------------------------*/
+void plat_net_shutdown() {
+    plat_net_disconnect();
+}
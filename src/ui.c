@@ -38,6 +38,7 @@ char *wild_variants_ascii[] = {
     "\x77\x69\x6c\x64\x20\x66\x72"  // wild fr
 };
 char *ui_yes_no_toggle[] = { "No", "Yes"};
+char *ui_games_sort[] = {"Sort: Rating", "Sort: Type"};
 // SQW switch to a name change, one action
 // char *ui_stop_actions[] = {"Resign", "Unobserve", "Stop Seek"};
 
@@ -126,6 +127,46 @@ static uint8_t ui_toggle_sought_callback(menu_t *m, void *data) {
     return MENU_DRAW_REDRAW; // Force a redraw since the menu size changes
 }
 
+/*-----------------------------------------------------------------------*/
+static uint8_t ui_observe_callback(menu_t *m, void *data) {
+    games_observe((menu_item_t *)data - m->menu_items);
+    // Get out of the way of the game
+    return MENU_DRAW_ERASE | MENU_DRAW_HIDDEN;
+}
+
+/*-----------------------------------------------------------------------*/
+static uint8_t ui_games_sort_callback(menu_t *m, void *data) {
+    menu_item_t *item = (menu_item_t *)data;
+    UNUSED(m);
+    games_sort(games.sort ^ 1);
+    item->item_name = ui_games_sort[games.sort];
+    return MENU_DRAW_REDRAW;
+}
+
+/*-----------------------------------------------------------------------*/
+static uint8_t ui_games_refresh_callback(menu_t *m, void *data) {
+    UNUSED(m);
+    UNUSED(data);
+    // The menu is shown again when the list is in
+    games_request();
+    return global.view.mc.df;
+}
+
+#ifdef RETROMATE_ARCHIVE
+/*-----------------------------------------------------------------------*/
+static uint8_t ui_archive_callback(menu_t *m, void *data) {
+    archive_load((menu_item_t *)data - m->menu_items);
+    // Get out of the way of the game
+    return MENU_DRAW_ERASE | MENU_DRAW_HIDDEN;
+}
+
+/*-----------------------------------------------------------------------*/
+static uint8_t ui_archive_page_callback(menu_t *m, void *data) {
+    archive_page((menu_item_t *)data == &m->menu_items[UI_ARCHIVE_OLDER]);
+    return MENU_DRAW_REDRAW;
+}
+#endif
+
 /*-----------------------------------------------------------------------*/
 #include <stdio.h>
 void ui_set_item_target(menu_item_t *item, uint8_t variable, char *value_str) {
@@ -152,11 +193,13 @@ menu_item_t ui_pregame_menu_options_menu_items[] = {
     { "Registered", MENU_ITEM_CYCLE, MENU_STATE_ENABLED, AS(ui_yes_no_toggle), ui_yes_no_toggle, 0, NULL, 0, 0, NULL, ui_toggle_registerd_callback},
     { "Host", MENU_ITEM_CALLBACK, MENU_STATE_ENABLED, 0, 0, 0, global.ui.server_name, sizeof(global.ui.server_name), FILTER_PRINTABLE, NULL, input_text_callback},
     { "Port", MENU_ITEM_CALLBACK, MENU_STATE_ENABLED, 0, 0, 0, global.ui.server_port_str, sizeof(global.ui.server_port_str), FILTER_NUM, (menu_t *) &global.ui.server_port, input_text_callback},
+    { "Auto Connect", MENU_ITEM_CYCLE, MENU_STATE_ENABLED, AS(ui_yes_no_toggle), ui_yes_no_toggle, 0, NULL, 0, 0, NULL, NULL},
     { "Back", MENU_ITEM_BACKUP, MENU_STATE_ENABLED, 0, 0, 0, NULL, 0, 0, NULL, NULL},
 };
 menu_t ui_pregame_menu_options_menu = {
     "Login Options", AS(ui_pregame_menu_options_menu_items), ui_pregame_menu_options_menu_items, 0, NULL
 };
+MENU_ITEMS_CHECK(ui_pregame_menu_options_menu_items);
 
 // Pre-game Menu
 menu_item_t ui_pregame_menu_items[] = {
@@ -167,6 +210,7 @@ menu_item_t ui_pregame_menu_items[] = {
 menu_t ui_pregame_menu = {
     "RetroMate V1.02", AS(ui_pregame_menu_items), ui_pregame_menu_items, 0, NULL
 };
+MENU_ITEMS_CHECK(ui_pregame_menu_items);
 
 /*-----------------------------------------------------------------------*/
 // In-game menus
@@ -185,11 +229,59 @@ menu_item_t ui_settings_menu_items[] = {
 menu_t ui_settings_menu = {
     "Game Settings", AS(ui_settings_menu_items), ui_settings_menu_items, 0, NULL
 };
+MENU_ITEMS_CHECK(ui_settings_menu_items);
+
+// In-game Menu Submenu: Observe Game.  The games come from the games index
+menu_item_t ui_observe_menu_items[] = {
+    { games.rows[0], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_observe_callback},
+    { games.rows[1], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_observe_callback},
+    { games.rows[2], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_observe_callback},
+    { games.rows[3], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_observe_callback},
+    { games.rows[4], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_observe_callback},
+    { games.rows[5], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_observe_callback},
+    { games.rows[6], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_observe_callback},
+    { games.rows[7], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_observe_callback},
+    { games.rows[8], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_observe_callback},
+    { games.rows[9], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_observe_callback},
+    { "Sort: Rating", MENU_ITEM_CALLBACK, MENU_STATE_ENABLED, 0, 0, 0, NULL, 0, 0, NULL, ui_games_sort_callback},
+    { "Refresh", MENU_ITEM_CALLBACK, MENU_STATE_ENABLED, 0, 0, 0, NULL, 0, 0, NULL, ui_games_refresh_callback},
+    { "Back", MENU_ITEM_BACKUP, MENU_STATE_ENABLED, 0, 0, 0, NULL, 0, 0, NULL, NULL},
+};
+menu_t ui_observe_menu = {
+    "Observe Game", AS(ui_observe_menu_items), ui_observe_menu_items, 0, NULL
+};
+MENU_ITEMS_CHECK(ui_observe_menu_items);
+
+#ifdef RETROMATE_ARCHIVE
+// In-game Menu Submenu: Past Games.  The games come from the archive index
+menu_item_t ui_archive_menu_items[] = {
+    { archive.rows[0], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_archive_callback},
+    { archive.rows[1], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_archive_callback},
+    { archive.rows[2], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_archive_callback},
+    { archive.rows[3], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_archive_callback},
+    { archive.rows[4], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_archive_callback},
+    { archive.rows[5], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_archive_callback},
+    { archive.rows[6], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_archive_callback},
+    { archive.rows[7], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_archive_callback},
+    { archive.rows[8], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_archive_callback},
+    { archive.rows[9], MENU_ITEM_CALLBACK, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, ui_archive_callback},
+    { "Older", MENU_ITEM_CALLBACK, MENU_STATE_DISABLED, 0, 0, 0, NULL, 0, 0, NULL, ui_archive_page_callback},
+    { "Newer", MENU_ITEM_CALLBACK, MENU_STATE_DISABLED, 0, 0, 0, NULL, 0, 0, NULL, ui_archive_page_callback},
+    { "Back", MENU_ITEM_BACKUP, MENU_STATE_ENABLED, 0, 0, 0, NULL, 0, 0, NULL, NULL},
+};
+menu_t ui_archive_menu = {
+    "Past Games", AS(ui_archive_menu_items), ui_archive_menu_items, 0, NULL
+};
+MENU_ITEMS_CHECK(ui_archive_menu_items);
+#endif
 
 // In-Game Menu
 menu_item_t ui_in_game_menu_items[] = {
     { "New Game", MENU_ITEM_STATIC, MENU_STATE_ENABLED, 0, 0, 0, NULL, 0, 0, NULL, NULL},
+    { "Observe Game", MENU_ITEM_STATIC, MENU_STATE_ENABLED, 0, 0, 0, NULL, 0, 0, NULL, NULL},
+    { "Past Games", MENU_ITEM_STATIC, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, NULL},
     { "Resign", MENU_ITEM_STATIC, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, NULL},
+    { "Claim Draw", MENU_ITEM_STATIC, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, NULL},
     { "Unobserve", MENU_ITEM_STATIC, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, NULL},
     { "Stop Seek", MENU_ITEM_STATIC, MENU_STATE_HIDDEN, 0, 0, 0, NULL, 0, 0, NULL, NULL},
     { "Game Settings", MENU_ITEM_SUBMENU, MENU_STATE_ENABLED, 0, 0, 0, NULL, 0, 0, &ui_settings_menu, NULL},
@@ -201,3 +293,4 @@ menu_item_t ui_in_game_menu_items[] = {
 menu_t ui_in_game_menu = {
     "RetroMate (Online)", AS(ui_in_game_menu_items), ui_in_game_menu_items, 0, NULL
 };
+MENU_ITEMS_CHECK(ui_in_game_menu_items);
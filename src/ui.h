@@ -16,6 +16,7 @@ enum {  // Menu - ui_pregame_menu_options_menu - Login Options
     UI_LOGIN_OPTIONS_REGISTERED,
     UI_LOGIN_OPTIONS_HOST,
     UI_LOGIN_OPTIONS_PORT,
+    UI_LOGIN_OPTIONS_AUTO_CONNECT,
     UI_LOGIN_OPTIONS_BACK,
 };
 
@@ -39,7 +40,10 @@ enum {  // Menu - ui_settings_menu - Game Settings
 
 enum {  // Menu - ui_in_game_menu - RetroMate (Online)
     UI_MENU_INGAME_NEW,
+    UI_MENU_INGAME_OBSERVE,
+    UI_MENU_INGAME_ARCHIVE,
     UI_MENU_INGAME_RESIGN,
+    UI_MENU_INGAME_DRAW,
     UI_MENU_INGAME_UNOBSERVE,
     UI_MENU_INGAME_STOP_SEEK,
     UI_MENU_INGAME_SETTINGS,
@@ -49,9 +53,29 @@ enum {  // Menu - ui_in_game_menu - RetroMate (Online)
     UI_MENU_INGAME_QUIT,
 };
 
+enum {  // Menu - ui_observe_menu - Observe Game
+    UI_OBSERVE_GAME,                // GAMES_MENU_ITEMS of these
+    UI_OBSERVE_SORT = GAMES_MENU_ITEMS,
+    UI_OBSERVE_REFRESH,
+    UI_OBSERVE_BACK,
+};
+
+#ifdef RETROMATE_ARCHIVE
+enum {  // Menu - ui_archive_menu - Past Games
+    UI_ARCHIVE_GAME,                // ARCHIVE_MENU_ITEMS of these
+    UI_ARCHIVE_OLDER = ARCHIVE_MENU_ITEMS,
+    UI_ARCHIVE_NEWER,
+    UI_ARCHIVE_BACK,
+};
+#endif
+
 extern menu_t ui_pregame_menu_options_menu;
 extern menu_t ui_pregame_menu;
 extern menu_t ui_in_game_menu;
+extern menu_t ui_observe_menu;
+#ifdef RETROMATE_ARCHIVE
+extern menu_t ui_archive_menu;
+#endif
 
 // Everything below this point needed only for initialisation in app.c
 
@@ -66,6 +66,7 @@ void input_text(char *buffer, uint8_t buffer_len, uint8_t filter) {
         switch (global.os.input_event.code) {
             case INPUT_VIEW_TOGGLE:
                 if (global.view.terminal_active) {
+                    log_scroll(&global.view.terminal, -(int)global.view.terminal.scroll);
                     return;
                 }
                 break;
@@ -73,6 +74,7 @@ void input_text(char *buffer, uint8_t buffer_len, uint8_t filter) {
             case INPUT_QUIT:
             case INPUT_BACK:
                 if (global.view.terminal_active) {
+                    log_scroll(&global.view.terminal, -(int)global.view.terminal.scroll);
                     return;
                 }
                 // In normal edit, it erases whatever was there, in edit colour
@@ -87,6 +89,8 @@ void input_text(char *buffer, uint8_t buffer_len, uint8_t filter) {
             case INPUT_SELECT:
                 plat_draw_clear_input_line(0);
                 if (global.view.terminal_active) {
+                    // Sending jumps back to the newest rows
+                    log_scroll(&global.view.terminal, -(int)global.view.terminal.scroll);
                     plat_net_send(buffer);
                     buffer[0] = '\0';
                     plat_draw_clear_input_line(1);
@@ -104,6 +108,15 @@ void input_text(char *buffer, uint8_t buffer_len, uint8_t filter) {
                 }
                 break;
 
+            case INPUT_UP:
+            case INPUT_DOWN:
+                // Page through the history, half a screen at a time
+                if (global.view.terminal_active) {
+                    int rows = global.view.terminal.rows / 2;
+                    log_scroll(&global.view.terminal, global.os.input_event.code == INPUT_UP ? rows : -rows);
+                }
+                break;
+
             case INPUT_VIEW_PAN_LEFT:
                 global.view.pan_value--;
                 global.view.terminal.modified = true;
@@ -0,0 +1,237 @@
+/*
+ *  zobrist.c
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#include "global.h"
+
+#ifndef __CC65__
+// Polyglot's own keys, so a book made by Polyglot can be looked up
+#include "random64.h"
+#else
+// The 8-bit machines have no book, so make a key when it's needed rather
+// than give up 6K of RAM for the table.  Any seed will do, but a key
+// mustn't change from one run to the next
+#define ZOBRIST_SEED            0x52657472UL    // "Retr"
+#endif
+
+zobrist_t zobrist;
+
+#ifdef __CC65__
+/*-----------------------------------------------------------------------*/
+// lowbias32 - each bit of x changes about half the bits of the result
+static uint32_t zobrist_hash(uint32_t x) {
+    x ^= x >> 16;
+    x *= 0x7FEB352DUL;
+    x ^= x >> 15;
+    x *= 0x846CA68BUL;
+    x ^= x >> 16;
+    return x;
+}
+
+/*-----------------------------------------------------------------------*/
+static void zobrist_make(uint16_t index, zobrist_key_t *key) {
+    uint32_t seed = ZOBRIST_SEED + ((uint32_t)index << 1);
+    key->hi = zobrist_hash(seed);
+    key->lo = zobrist_hash(seed + 1);
+}
+#endif
+
+/*-----------------------------------------------------------------------*/
+// The key of a piece enum (with color) on square (a1 = 0)
+static void zobrist_piece_key(uint8_t piece, uint8_t square, zobrist_key_t *key) {
+    // Polyglot order for the piece enum
+    static const uint8_t piece_kind[7] = {0, 3, 1, 2, 4, 5, 0};
+    uint16_t kind = (piece_kind[piece & ~PIECE_WHITE] << 1) | MOVEGEN_SIDE(piece);
+    zobrist_key((kind << 6) | square, key);
+}
+
+/*-----------------------------------------------------------------------*/
+// XOR the key for the FICS letter on square (a8 = 0) into zobrist.key
+static void zobrist_piece(uint8_t square, char letter) {
+    zobrist_key_t key;
+    zobrist_piece_key(fics_letter_to_piece(letter), square ^ 56, &key);
+    ZOBRIST_XOR(zobrist.key, key);
+}
+
+/*-----------------------------------------------------------------------*/
+// Key the position global already holds
+static void zobrist_position() {
+    uint8_t i;
+
+    zobrist.key.hi = zobrist.key.lo = 0;
+    zobrist.white = false;
+    zobrist.castle = 0;
+    zobrist.ep = ZOBRIST_NO_EP;
+    for (i = 0; i < 64; i++) {
+        zobrist_square(i, '\x2d', global.state.chess_board[i]); // '-'
+    }
+    zobrist_flags();
+    zobrist_history_clear();
+}
+
+/*-----------------------------------------------------------------------*/
+// Bring the side to move, castling and en passant keys in line with
+// global.frame.  The board must already be up to date
+void zobrist_flags() {
+    zobrist_key_t key;
+    uint8_t castle = 0;
+    uint8_t ep = ZOBRIST_NO_EP;
+    uint8_t changed, i;
+    // 'W'
+    bool white = *global.frame.color_to_move == '\x57';
+
+    // '1'
+    if (*global.frame.w_can_castle_s == '\x31') {
+        castle |= ZOBRIST_CASTLE_WS;
+    }
+    if (*global.frame.w_can_castle_l == '\x31') {
+        castle |= ZOBRIST_CASTLE_WL;
+    }
+    if (*global.frame.b_can_castle_s == '\x31') {
+        castle |= ZOBRIST_CASTLE_BS;
+    }
+    if (*global.frame.b_can_castle_l == '\x31') {
+        castle |= ZOBRIST_CASTLE_BL;
+    }
+
+    // The file of a double push, or -1.  As in Polyglot, it's only part of
+    // the position if a pawn stands ready to take en passant
+    i = *global.frame.double_pawn_push - '\x30';        // '0'
+    if (i < 8) {
+        // Row 3 is the 5th rank, where a white pawn takes from
+        const char *row = &global.state.chess_board[white ? 3 * 8 : 4 * 8];
+        char pawn = white ? '\x50' : '\x70';            // 'P' : 'p'
+        if ((i > 0 && row[i - 1] == pawn) || (i < 7 && row[i + 1] == pawn)) {
+            ep = i;
+        }
+    }
+
+    if (white != zobrist.white) {
+        zobrist_key(ZOBRIST_TURN, &key);
+        ZOBRIST_XOR(zobrist.key, key);
+        zobrist.white = white;
+    }
+    changed = castle ^ zobrist.castle;
+    for (i = 0; changed; i++, changed >>= 1) {
+        if (changed & 1) {
+            zobrist_key(ZOBRIST_CASTLE + i, &key);
+            ZOBRIST_XOR(zobrist.key, key);
+        }
+    }
+    zobrist.castle = castle;
+    if (ep != zobrist.ep) {
+        if (zobrist.ep != ZOBRIST_NO_EP) {
+            zobrist_key(ZOBRIST_EP + zobrist.ep, &key);
+            ZOBRIST_XOR(zobrist.key, key);
+        }
+        if (ep != ZOBRIST_NO_EP) {
+            zobrist_key(ZOBRIST_EP + ep, &key);
+            ZOBRIST_XOR(zobrist.key, key);
+        }
+        zobrist.ep = ep;
+    }
+}
+
+/*-----------------------------------------------------------------------*/
+void zobrist_history_clear() {
+    zobrist.history_head = 0;
+    zobrist.history_count = 0;
+}
+
+/*-----------------------------------------------------------------------*/
+void zobrist_init() {
+    zobrist_position();
+}
+
+/*-----------------------------------------------------------------------*/
+void zobrist_key(uint16_t index, zobrist_key_t *key) {
+#ifndef __CC65__
+    *key = zobrist_random64[index];
+#else
+    zobrist_make(index, key);
+#endif
+}
+
+#ifndef __CC65__
+/*-----------------------------------------------------------------------*/
+// The key of a movegen position, made the same way as zobrist.key
+void zobrist_position_key(const position_t *p, zobrist_key_t *key) {
+    zobrist_key_t k;
+    uint8_t sq, pawn;
+
+    key->hi = key->lo = 0;
+    for (sq = 0; sq < MOVEGEN_SQUARES; sq++) {
+        if (MOVEGEN_OFF_BOARD(sq)) {
+            sq += 7;
+        } else if (p->board[sq]) {
+            zobrist_piece_key(p->board[sq], (MOVEGEN_RANK(sq) << 3) | MOVEGEN_FILE(sq), &k);
+            ZOBRIST_XOR(*key, k);
+        }
+    }
+    // MOVEGEN_CASTLE_* are the same bits as ZOBRIST_CASTLE_*
+    for (sq = 0; sq < 4; sq++) {
+        if (p->castle & (1 << sq)) {
+            zobrist_key(ZOBRIST_CASTLE + sq, &k);
+            ZOBRIST_XOR(*key, k);
+        }
+    }
+    if (p->ep != MOVEGEN_NO_SQUARE) {
+        // Look either side of the pawn that moved 2
+        pawn = PAWN | (p->side == SIDE_WHITE ? PIECE_WHITE : 0);
+        sq = p->side == SIDE_WHITE ? p->ep - 16 : p->ep + 16;
+        if ((!MOVEGEN_OFF_BOARD(sq - 1) && p->board[sq - 1] == pawn) ||
+                (!MOVEGEN_OFF_BOARD(sq + 1) && p->board[sq + 1] == pawn)) {
+            zobrist_key(ZOBRIST_EP + MOVEGEN_FILE(p->ep), &k);
+            ZOBRIST_XOR(*key, k);
+        }
+    }
+    if (p->side == SIDE_WHITE) {
+        zobrist_key(ZOBRIST_TURN, &k);
+        ZOBRIST_XOR(*key, k);
+    }
+}
+#endif
+
+/*-----------------------------------------------------------------------*/
+// Remember zobrist.key, and return how often the position has now been
+// seen, 1 the first time.  irreversible is the plies since a capture or pawn
+// move, as nothing before that can come round again
+uint8_t zobrist_repetitions(uint8_t irreversible) {
+    uint8_t seen = 1;
+    uint8_t i, index = zobrist.history_head;
+
+    if (irreversible > zobrist.history_count) {
+        irreversible = zobrist.history_count;
+    }
+    for (i = 0; i < irreversible; i++) {
+        index = index ? index - 1 : ZOBRIST_HISTORY - 1;
+        if (ZOBRIST_SAME(zobrist.history[index], zobrist.key)) {
+            seen++;
+        }
+    }
+
+    zobrist.history[zobrist.history_head] = zobrist.key;
+    if (++zobrist.history_head == ZOBRIST_HISTORY) {
+        zobrist.history_head = 0;
+    }
+    if (zobrist.history_count < ZOBRIST_HISTORY) {
+        zobrist.history_count++;
+    }
+    return seen;
+}
+
+/*-----------------------------------------------------------------------*/
+// square (a8 = 0) changed from the FICS letter before to after
+void zobrist_square(uint8_t square, char before, char after) {
+    if (before != '\x2d') {                         // '-'
+        zobrist_piece(square, before);
+    }
+    if (after != '\x2d') {
+        zobrist_piece(square, after);
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ *  zobrist.h
+ *  RetroMate
+ *
+ *  By S. Wessels, 2025.
+ *  This is free and unencumbered software released into the public domain.
+ *
+ */
+
+#ifndef _ZOBRIST_H_
+#define _ZOBRIST_H_
+
+// Keys are laid out as Polyglot does - 12 pieces (black pawn, white pawn,
+// black knight ... white king) on 64 squares (a1 = 0, h8 = 63), then the 4
+// castling rights, the 8 en passant files and white to move
+#define ZOBRIST_CASTLE          768     // White short, white long, black short, black long
+#define ZOBRIST_EP              772
+#define ZOBRIST_TURN            780
+#define ZOBRIST_KEYS            781
+#define ZOBRIST_NO_EP           8
+
+// zobrist_t castle
+#define ZOBRIST_CASTLE_WS       0x01
+#define ZOBRIST_CASTLE_WL       0x02
+#define ZOBRIST_CASTLE_BS       0x04
+#define ZOBRIST_CASTLE_BL       0x08
+
+// Positions kept to spot a repetition.  The 50 move rule means no more than
+// 100 plies can matter, but the 8-bit machines keep fewer
+#ifdef __CC65__
+#define ZOBRIST_HISTORY         40
+#else
+#define ZOBRIST_HISTORY         100
+#endif
+
+// A 64 bit key in two halves, since cc65 has no 64 bit type
+typedef struct _zobrist_key {
+    uint32_t hi;
+    uint32_t lo;
+} zobrist_key_t;
+
+#define ZOBRIST_XOR(a, b)       ((a).hi ^= (b).hi, (a).lo ^= (b).lo)
+#define ZOBRIST_SAME(a, b)      ((a).hi == (b).hi && (a).lo == (b).lo)
+
+// The position in global.state.chess_board and global.frame, hashed
+typedef struct _zobrist {
+    zobrist_key_t key;
+    bool white;                     // White to move
+    uint8_t castle;                 // ZOBRIST_CASTLE_* in the key
+    uint8_t ep;                     // File in the key, or ZOBRIST_NO_EP
+    uint8_t repeats;                // Times the position has been seen
+    uint8_t history_head;           // Where the next key goes
+    uint8_t history_count;
+    zobrist_key_t history[ZOBRIST_HISTORY];
+} zobrist_t;
+
+extern zobrist_t zobrist;
+
+void zobrist_flags(void);
+void zobrist_history_clear(void);
+void zobrist_init(void);
+void zobrist_key(uint16_t index, zobrist_key_t *key);
+#ifndef __CC65__
+void zobrist_position_key(const position_t *p, zobrist_key_t *key);
+#endif
+uint8_t zobrist_repetitions(uint8_t irreversible);
+void zobrist_square(uint8_t square, char before, char after);
+
+#endif // _ZOBRIST_H_